@@ -4,21 +4,98 @@
 /* Include */
 // performing allocation and deallocation
 #include <sys/mman.h>
+#include <linux/mempolicy.h>
 
 // doing linux syscalls
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/sendfile.h>
+#include <errno.h>
+#include <linux/futex.h>
+#include <linux/memfd.h>
+#include <time.h>
+
+// asynchronous io
+#include <linux/io_uring.h>
+#include <pthread.h>
 
 // debug info
 #include <stdio.h>
 
+// vectorized memory operations
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(BM0__disable__simd)
+#include <immintrin.h>
+#endif
+
+// kernel constants that are left out without _GNU_SOURCE or by older headers
+#ifndef MREMAP_MAYMOVE
+#define MREMAP_MAYMOVE 1
+#endif
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+/* Options */
+// the decoded engine dispatches through computed gotos when the compiler supports them, define BM0__disable__threaded_dispatch to use a switch instead
+#if defined(__GNUC__) && !defined(BM0__disable__threaded_dispatch) && !defined(BM0__enable__threaded_dispatch)
+#define BM0__enable__threaded_dispatch
+#endif
+
+// bulk memory operations use SSE2 or AVX2 (picked at runtime) on x86-64, define BM0__disable__simd to use plain loops instead
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(BM0__disable__simd)
+#define BM0__enable__simd
+#endif
+
+// asynchronous io goes through io_uring when the kernel allows it, define BM0__disable__io_uring to always use the thread pool instead
+
+// define BM0__enable__jit to compile hot code of decoded programs to x86-64
+#if defined(BM0__enable__jit) && !defined(__x86_64__)
+#error "BM0__enable__jit requires an x86-64 host"
+#endif
+
+// define BM0__enable__profiler to let contexts count executions and cycles per instruction, operation, syscall and program offset
+
+// define BM0__enable__trace to let contexts record the last instructions they ran into a ring buffer
+
 /* Define */
 typedef enum BM0__define {
     BM0__define__register_count = 256,
     BM0__define__max_allocation_count = 256,
     BM0__define__max_input_sub_buffer_count = 16,
-    BM0__define__max_parameter_count = 8
+    BM0__define__max_parameter_count = 8,
+    BM0__define__max_instruction_length = 11,
+    BM0__define__max_superinstruction_length = 27, // operate, write register and operate
+    BM0__define__jit_compile_threshold = 2,
+    BM0__define__jit_cached_register_count = 4,
+    BM0__define__jit_max_block_length = 256,
+    BM0__define__jit_max_instruction_code_length = 192,
+    BM0__define__jit_code_bytes_per_program_byte = 32,
+    BM0__define__jit_minimum_code_length = 65536,
+    BM0__define__arena_chunk_length = 1048576,
+    BM0__define__arena_minimum_block_length = 16,
+    BM0__define__arena_size_class_count = 13, // 16 bytes to 64 kilobytes
+    BM0__define__vector_register_count = 256,
+    BM0__define__vector_register_length = 32,
+    BM0__define__io_ring_entry_count = 64,
+    BM0__define__io_slot_count = 128, // at most the completion ring size, which is twice the entry count
+    BM0__define__io_thread_count = 4,
+    BM0__define__io_max_length = 0x7ffff000, // the most the kernel moves in one read or write, longer requests finish short
+    BM0__define__max_io_vector_count = 64,
+    BM0__define__program_file_version = 6, // bumped whenever BM0__dit or BM0__decoded_instruction change
+    BM0__define__program_file_alignment = 64,
+    BM0__define__max_channel_count = 16,
+    BM0__define__max_thread_count = 64, // threads a machine can spawn per run, besides itself
+    BM0__define__snapshot_page_length = 4096, // allocations are stored at multiples of it so each can be mapped on its own
+    BM0__define__page_length = 4096,
+    BM0__define__huge_page_length = 2097152,
+    BM0__define__allocation_policy_node_shift = 32, // the node of BM0__apt__bind_to_node is stored above the policy bits
+    BM0__define__hash_table_group_length = 16, // control bytes probed at once
+    BM0__define__hash_table_minimum_capacity = 16,
+    BM0__define__hash_table_maximum_capacity_bits = 56 // keeps the rounded capacity and the table's length from overflowing
 } BM0__define;
 
 /* Boolean */
@@ -50,7 +127,14 @@ unsigned long long BM0__null_terminated_string_length_without_null(char* c_strin
 }
 
 void* BM0__allocate(unsigned long long length) {
-    return mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    void* output = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    // report failure as a null pointer
+    if (output == MAP_FAILED) {
+        return 0;
+    }
+
+    return output;
 }
 
 void BM0__deallocate(void* address, unsigned long long length) {
@@ -59,14 +143,304 @@ void BM0__deallocate(void* address, unsigned long long length) {
     return;
 }
 
+// allocation policy type, bits that can be combined
+typedef enum BM0__apt {
+    BM0__apt__default = 0,
+    BM0__apt__transparent_huge_pages = 1, // asks the kernel to back the memory with huge pages when it can
+    BM0__apt__huge_pages = 2, // from the reserved huge page pool, the length is rounded up to whole huge pages, falls back to transparent huge pages when none are reserved
+    BM0__apt__prefault = 4, // every page is faulted in before the memory is handed out
+    BM0__apt__bind_to_node = 8, // only takes memory from the NUMA node in the bits above BM0__define__allocation_policy_node_shift
+    BM0__apt__interleave = 16 // spreads pages over every NUMA node
+} BM0__apt;
+
+// maps memory following a policy, the length is updated when it was rounded up, reports failure as a null pointer
+// huge pages are a hint, memory is still handed out on hosts without them, placed is cleared when the kernel refused the NUMA placement
+void* BM0__allocate_with_policy(unsigned long long* length, unsigned long long policy, BM0__boolean* placed) {
+    void* output = MAP_FAILED;
+    unsigned long node_mask;
+    unsigned long long huge_length;
+
+    *placed = BM0__boolean__true;
+    if (policy == BM0__apt__default) {
+        return BM0__allocate(*length);
+    }
+
+    // map
+    if ((policy & BM0__apt__huge_pages) != 0) {
+        huge_length = (*length + BM0__define__huge_page_length - 1) & ~((unsigned long long)BM0__define__huge_page_length - 1);
+        output = mmap(0, huge_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (output != MAP_FAILED) {
+            *length = huge_length;
+        }
+    }
+    if (output == MAP_FAILED) {
+        output = mmap(0, *length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (output == MAP_FAILED) {
+            return 0;
+        }
+        if ((policy & (BM0__apt__transparent_huge_pages | BM0__apt__huge_pages)) != 0) {
+            madvise(output, *length, MADV_HUGEPAGE);
+        }
+    }
+
+    // place, before anything is faulted in
+    if ((policy & BM0__apt__bind_to_node) != 0) {
+        node_mask = (policy >> BM0__define__allocation_policy_node_shift) < sizeof(node_mask) * 8 ? 1ul << (policy >> BM0__define__allocation_policy_node_shift) : 0;
+        *placed = (BM0__boolean)(node_mask != 0 && syscall(__NR_mbind, output, *length, MPOL_BIND, &node_mask, sizeof(node_mask) * 8 + 1, 0) == 0);
+    } else if ((policy & BM0__apt__interleave) != 0) {
+        node_mask = ~0ul;
+        *placed = (BM0__boolean)(syscall(__NR_mbind, output, *length, MPOL_INTERLEAVE, &node_mask, sizeof(node_mask) * 8 + 1, 0) == 0);
+    }
+
+    // fault in, touching every page on kernels without MADV_POPULATE_WRITE
+    if ((policy & BM0__apt__prefault) != 0 && madvise(output, *length, MADV_POPULATE_WRITE) != 0) {
+        for (unsigned long long i = 0; i < *length; i += BM0__define__page_length) {
+            ((volatile unsigned char*)output)[i] = 0;
+        }
+    }
+
+    return output;
+}
+
+#ifdef BM0__enable__simd
+// simd level type
+typedef enum BM0__slt {
+    BM0__slt__unknown,
+    BM0__slt__sse2, // always present on x86-64
+    BM0__slt__avx2
+} BM0__slt;
+
+// detected on first use, then cached
+BM0__slt BM0__get_simd_level() {
+    static BM0__slt level = BM0__slt__unknown;
+
+    if (level == BM0__slt__unknown) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            level = BM0__slt__avx2;
+        } else {
+            level = BM0__slt__sse2;
+        }
+    }
+
+    return level;
+}
+
+// the kernels below only handle whole vectors and return how many bytes they covered, their callers finish the rest byte by byte
+unsigned long long BM0__simd__copy_forward__sse2(void* source, unsigned long long length, void* destination) {
+    unsigned long long i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        _mm_storeu_si128((__m128i*)(destination + i), _mm_loadu_si128((__m128i*)(source + i)));
+    }
+
+    return i;
+}
+
+__attribute__((target("avx2"))) unsigned long long BM0__simd__copy_forward__avx2(void* source, unsigned long long length, void* destination) {
+    unsigned long long i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_loadu_si256((__m256i*)(source + i)));
+    }
+
+    return i;
+}
+
+// covers the end of the range, for destinations that start inside the source
+unsigned long long BM0__simd__copy_backward__sse2(void* source, unsigned long long length, void* destination) {
+    unsigned long long i = length;
+
+    while (i >= 16) {
+        i -= 16;
+        _mm_storeu_si128((__m128i*)(destination + i), _mm_loadu_si128((__m128i*)(source + i)));
+    }
+
+    return length - i;
+}
+
+__attribute__((target("avx2"))) unsigned long long BM0__simd__copy_backward__avx2(void* source, unsigned long long length, void* destination) {
+    unsigned long long i = length;
+
+    while (i >= 32) {
+        i -= 32;
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_loadu_si256((__m256i*)(source + i)));
+    }
+
+    return length - i;
+}
+
+unsigned long long BM0__simd__fill__sse2(void* destination, unsigned long long length, unsigned char value) {
+    __m128i vector = _mm_set1_epi8((char)value);
+    unsigned long long i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        _mm_storeu_si128((__m128i*)(destination + i), vector);
+    }
+
+    return i;
+}
+
+__attribute__((target("avx2"))) unsigned long long BM0__simd__fill__avx2(void* destination, unsigned long long length, unsigned char value) {
+    __m256i vector = _mm256_set1_epi8((char)value);
+    unsigned long long i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        _mm256_storeu_si256((__m256i*)(destination + i), vector);
+    }
+
+    return i;
+}
+
+// stops at the first differing byte
+unsigned long long BM0__simd__compare__sse2(void* a, void* b, unsigned long long length) {
+    unsigned int mask;
+    unsigned long long i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(a + i)), _mm_loadu_si128((__m128i*)(b + i))));
+        if (mask != 0xFFFF) {
+            return i + (unsigned long long)__builtin_ctz(~mask);
+        }
+    }
+
+    return i;
+}
+
+__attribute__((target("avx2"))) unsigned long long BM0__simd__compare__avx2(void* a, void* b, unsigned long long length) {
+    unsigned int mask;
+    unsigned long long i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+        if (mask != 0xFFFFFFFF) {
+            return i + (unsigned long long)__builtin_ctz(~mask);
+        }
+    }
+
+    return i;
+}
+#endif
+
 void BM0__copy_bytes(void* source, unsigned long long length, void* destination) {
-    for (unsigned long long i = 0; i < length; i++) {
+    unsigned long long i = 0;
+
+#ifdef BM0__enable__simd
+    // vectors read ahead of where they write, so destinations starting inside the source stay byte by byte
+    if (length >= 16 && (destination <= source || destination >= source + length)) {
+        if (BM0__get_simd_level() == BM0__slt__avx2) {
+            i = BM0__simd__copy_forward__avx2(source, length, destination);
+        } else {
+            i = BM0__simd__copy_forward__sse2(source, length, destination);
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
         *((unsigned char*)(destination + i)) = *((unsigned char*)source + i);
     }
 
     return;
 }
 
+// like BM0__copy_bytes but the source and destination may overlap in any way
+void BM0__move_bytes(void* source, unsigned long long length, void* destination) {
+    unsigned long long i = length;
+
+    // destinations starting inside the source are copied from the end
+    if (destination > source && destination < source + length) {
+#ifdef BM0__enable__simd
+        if (length >= 16) {
+            if (BM0__get_simd_level() == BM0__slt__avx2) {
+                i -= BM0__simd__copy_backward__avx2(source, length, destination);
+            } else {
+                i -= BM0__simd__copy_backward__sse2(source, length, destination);
+            }
+        }
+#endif
+
+        while (i > 0) {
+            i--;
+            *((unsigned char*)(destination + i)) = *((unsigned char*)source + i);
+        }
+
+        return;
+    }
+
+    BM0__copy_bytes(source, length, destination);
+
+    return;
+}
+
+void BM0__fill_bytes(void* destination, unsigned long long length, unsigned char value) {
+    unsigned long long i = 0;
+
+#ifdef BM0__enable__simd
+    if (length >= 16) {
+        if (BM0__get_simd_level() == BM0__slt__avx2) {
+            i = BM0__simd__fill__avx2(destination, length, value);
+        } else {
+            i = BM0__simd__fill__sse2(destination, length, value);
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
+        *((unsigned char*)(destination + i)) = value;
+    }
+
+    return;
+}
+
+void BM0__zero_bytes(void* destination, unsigned long long length) {
+    BM0__fill_bytes(destination, length, 0);
+
+    return;
+}
+
+// returns the offset of the first differing byte, or the length if both are the same
+unsigned long long BM0__compare_bytes(void* a, void* b, unsigned long long length) {
+    unsigned long long i = 0;
+
+#ifdef BM0__enable__simd
+    if (length >= 16) {
+        if (BM0__get_simd_level() == BM0__slt__avx2) {
+            i = BM0__simd__compare__avx2(a, b, length);
+        } else {
+            i = BM0__simd__compare__sse2(a, b, length);
+        }
+    }
+#endif
+
+    while (i < length && *((unsigned char*)(a + i)) == *((unsigned char*)(b + i))) {
+        i++;
+    }
+
+    return i;
+}
+
+// hashes 8 bytes at a time, used for program files and assembler labels
+unsigned long long BM0__hash_bytes(void* data, unsigned long long length) {
+    unsigned long long output = 0x9E3779B97F4A7C15ull ^ length;
+    unsigned long long word;
+    unsigned long long i = 0;
+
+    // whole words
+    for (; i + sizeof(unsigned long long) <= length; i += sizeof(unsigned long long)) {
+        __builtin_memcpy(&word, data + i, sizeof(unsigned long long));
+        output = (output ^ word) * 0xFF51AFD7ED558CCDull;
+        output ^= output >> 32;
+    }
+
+    // remaining bytes
+    word = 0;
+    BM0__copy_bytes(data + i, length - i, &word);
+    output = (output ^ word) * 0xFF51AFD7ED558CCDull;
+    output ^= output >> 29;
+
+    return output;
+}
+
 void BM0__change_void_pointer_in_place(void** variable_reference, unsigned long long change) {
     *variable_reference = (void*)(((unsigned long long)(*variable_reference)) + change);
 
@@ -100,7 +474,41 @@ typedef enum BM0__et {
     BM0__et__unimplemented_syscall, // critical error
 
     // instruction reading
-    BM0__et__unimplemented_instruction_ID // critical error
+    BM0__et__unimplemented_instruction_ID, // critical error
+
+    // asynchronous io
+    BM0__et__io_queue_unavailable,
+
+    // batches
+    BM0__et__thread_pool_unavailable,
+    BM0__et__batch_too_large,
+
+    // verification
+    BM0__et__program_runs_past_end,
+
+    // program files
+    BM0__et__program_file_unavailable,
+    BM0__et__invalid_program_file,
+
+    // assembly
+    BM0__et__invalid_assembly,
+    BM0__et__undefined_assembler_label,
+
+    // channels
+    BM0__et__channel_unavailable,
+
+    // threads
+    BM0__et__thread_unavailable,
+    BM0__et__unaligned_atomic_address,
+
+    // snapshots
+    BM0__et__snapshot_unavailable,
+
+    // hash tables
+    BM0__et__invalid_hash_table,
+
+    // allocation policies
+    BM0__et__allocation_policy_refused // the memory is still handed out, only without the NUMA placement that was asked for
 } BM0__et;
 
 /* Buffer */
@@ -147,6 +555,26 @@ BM0__buffer BM0__create_buffer(BM0__et* error, unsigned long long length) {
     return output;
 }
 
+// same as BM0__create_buffer, the buffer can be longer than asked for when it uses huge pages
+// a refused NUMA placement is reported as an error while the buffer is still handed out
+BM0__buffer BM0__create_buffer_with_policy(BM0__et* error, unsigned long long length, unsigned long long policy) {
+    BM0__buffer output;
+    BM0__boolean placed;
+
+    output.p_length = length;
+    output.p_data = BM0__allocate_with_policy(&output.p_length, policy, &placed);
+    if (output.p_data == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return BM0__create_null_buffer();
+    }
+    if (placed == BM0__boolean__false) {
+        *error = BM0__et__allocation_policy_refused;
+    }
+
+    return output;
+}
+
 BM0__buffer BM0__create_buffer_from_c_string_copy(BM0__et* error, char* c_string) {
     BM0__buffer output;
     unsigned long long length = BM0__null_terminated_string_length_without_null(c_string);
@@ -160,600 +588,3560 @@ BM0__buffer BM0__create_buffer_from_c_string_copy(BM0__et* error, char* c_string
     return output;
 }
 
-/* Allocation Management */
-typedef struct BM0__allocations {
-    BM0__buffer p_buffers[BM0__define__max_allocation_count];
-} BM0__allocations;
+/* Arena */
+// small allocations come from size classed free lists carved out of large chunks, large allocations are mapped on their own
+typedef struct BM0__arena {
+    void* p_chunks; // each chunk starts with a pointer to the next chunk
+    void* p_current_chunk;
+    unsigned long long p_current_chunk_used;
+    void* p_free_lists[BM0__define__arena_size_class_count]; // each free block starts with a pointer to the next free block
+    void* p_large_allocations; // each large allocation is preceded by a BM0__arena_large_header
+} BM0__arena;
+
+// sits right before a large allocation
+typedef struct BM0__arena_large_header {
+    void* p_next;
+    void* p_previous;
+    unsigned long long p_length; // including the header
+    unsigned long long p_padding[5]; // keeps allocations 64 byte aligned
+} BM0__arena_large_header;
+
+BM0__arena BM0__create_arena() {
+    BM0__arena output;
+
+    output.p_chunks = 0;
+    output.p_current_chunk = 0;
+    output.p_current_chunk_used = 0;
+    for (unsigned long long i = 0; i < BM0__define__arena_size_class_count; i++) {
+        output.p_free_lists[i] = 0;
+    }
+    output.p_large_allocations = 0;
 
-BM0__boolean BM0__check_allocation_exists(BM0__allocations* allocations, unsigned long long handle) {
-    return (BM0__boolean)((*allocations).p_buffers[handle].p_data == 0);
+    return output;
 }
 
-void BM0__create_null_allocations(BM0__allocations* allocations) {
-    // make all buffers null
-    for (unsigned long long i = 0; i < BM0__define__max_allocation_count; i++) {
-        (*allocations).p_buffers[i] = BM0__create_null_buffer();
+// returns the size class of a small allocation, or BM0__define__arena_size_class_count for a large one
+unsigned long long BM0__get_arena_size_class(unsigned long long length) {
+    unsigned long long size_class = 0;
+
+    while (size_class < BM0__define__arena_size_class_count && ((unsigned long long)BM0__define__arena_minimum_block_length << size_class) < length) {
+        size_class++;
     }
 
-    return;
+    return size_class;
 }
 
-unsigned long long BM0__allocate_buffer_to_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long allocation_size) {
-    // go through buffers until an empty is found or no empty buffers are found
-    for (unsigned long long i = 0; i < BM0__define__max_allocation_count; i++) {
-        // check if buffer is available
-        if (BM0__check_allocation_exists(allocations, i)) {
-            // create allocation
-            (*allocations).p_buffers[i] = BM0__create_buffer(error, allocation_size);
+void* BM0__arena_allocate_large(BM0__arena* arena, unsigned long long length) {
+    BM0__arena_large_header* header;
 
-            // found empty buffer, give back allocation handle
-            return i;
-        }
+    // a length the header would wrap around is rejected like mmap rejects it without an arena
+    if (length > ~0ull - sizeof(BM0__arena_large_header)) {
+        return 0;
     }
 
-    // no empty buffers are found
-    *error = BM0__et__allocation_failure__at_maximum;
-
-    // return 1 over the maximum indexable value
-    return BM0__define__max_allocation_count;
-}
-
-unsigned long long BM0__allocation_count(BM0__allocations* allocations) {
-    unsigned long long output = 0;
+    header = (BM0__arena_large_header*)BM0__allocate(length + sizeof(BM0__arena_large_header));
+    if (header == 0) {
+        return 0;
+    }
 
-    // go through all buffers, counting all used slots
-    for (unsigned long long i = 0; i < BM0__define__max_allocation_count; i++) {
-        if ((*allocations).p_buffers[i].p_data != 0) {
-            output++;
-        }
+    // link allocation
+    header->p_next = arena->p_large_allocations;
+    header->p_previous = 0;
+    header->p_length = length + sizeof(BM0__arena_large_header);
+    if (arena->p_large_allocations != 0) {
+        ((BM0__arena_large_header*)arena->p_large_allocations)->p_previous = header;
     }
+    arena->p_large_allocations = header;
 
-    return output;
+    return (void*)(header + 1);
 }
 
-void BM0__deallocate_buffer_from_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long handle) {
-    // check if the buffer is in use
-    if ((*allocations).p_buffers[handle].p_data != 0) {
-        // destroy buffer
-        BM0__destroy_buffer((*allocations).p_buffers[handle]);
+// unlinks a large allocation so the arena no longer frees it, it stays mapped together with its header
+void BM0__arena_release_large(BM0__arena* arena, void* address) {
+    BM0__arena_large_header* header = ((BM0__arena_large_header*)address) - 1;
 
-        // zero buffer
-        (*allocations).p_buffers[handle] = BM0__create_null_buffer();
-    // cannot deallocate non-existent buffer
+    // unlink allocation
+    if (header->p_previous != 0) {
+        ((BM0__arena_large_header*)header->p_previous)->p_next = header->p_next;
     } else {
-        *error = BM0__et__deallocation_failure;
+        arena->p_large_allocations = header->p_next;
+    }
+    if (header->p_next != 0) {
+        ((BM0__arena_large_header*)header->p_next)->p_previous = header->p_previous;
     }
 
     return;
 }
 
-/* Byte Machine */
-// instruction length type
-typedef enum BM0__ilt {
-    BM0__ilt__quit = 4,
-    BM0__ilt__write_register = 11,
-    BM0__ilt__allocate = 6,
-    BM0__ilt__deallocate = 3,
-    BM0__ilt__buffer_to_register = 5,
-    BM0__ilt__register_to_register = 4,
-    BM0__ilt__register_to_buffer = 5,
-    BM0__ilt__operate = 8,
-    BM0__ilt__do_x86_64_linux_syscall_limited = 10
-} BM0__ilt;
+// frees a large allocation that was released from its arena
+void BM0__deallocate_released_arena_allocation(void* address) {
+    BM0__arena_large_header* header = ((BM0__arena_large_header*)address) - 1;
 
-// register type
-typedef enum BM0__rt {
-    BM0__rt__instruction_pointer_register = 0,
-    BM0__rt__instruction_ID_register = 1,
-    BM0__rt__instruction_parameter_register_0 = 2,
-    BM0__rt__instruction_parameter_register_1 = 3,
-    BM0__rt__instruction_parameter_register_2 = 4,
-    BM0__rt__instruction_parameter_register_3 = 5,
-    BM0__rt__instruction_parameter_register_4 = 6,
-    BM0__rt__instruction_parameter_register_5 = 7,
-    BM0__rt__instruction_parameter_register_6 = 8,
-    BM0__rt__instruction_parameter_register_7 = 9,
-    BM0__rt__input_buffers_length_register = 10,
-    BM0__rt__input_buffers_pointer_register = 11,
-    BM0__rt__instruction_error_code_register_register = 12,
-    BM0__rt__REGISTER_COUNT = 13
-} BM0__rt;
+    BM0__deallocate(header, header->p_length);
 
-// instruction type
-typedef enum BM0__it {
-    BM0__it__quit,
-    BM0__it__write_register,
-    BM0__it__allocate,
-    BM0__it__deallocate,
-    BM0__it__buffer_to_register,
-    BM0__it__register_to_register,
-    BM0__it__register_to_buffer,
-    BM0__it__operate,
-    BM0__it__do_x86_64_linux_syscall_limited
-} BM0__it;
+    return;
+}
 
-// operation type
-typedef enum BM0__ot {
-    // binary
-    BM0__ot__binary__right_shift,
-    BM0__ot__binary__left_shift,
-    BM0__ot__binary__not,
-    BM0__ot__binary__and,
-    BM0__ot__binary__or,
-    BM0__ot__binary__xor,
+void BM0__arena_deallocate_large(BM0__arena* arena, void* address) {
+    BM0__arena_release_large(arena, address);
+    BM0__deallocate_released_arena_allocation(address);
 
-    // integer
-    BM0__ot__integer__add,
-    BM0__ot__integer__subtract,
-    BM0__ot__integer__multiply,
-    BM0__ot__integer__divide,
-    BM0__ot__integer__modulous,
+    return;
+}
 
-    // Comparison
-    BM0__ot__comparison__less_than,
-    BM0__ot__comparison__equal_to,
-    BM0__ot__comparison__not_equal_to,
-    BM0__ot__comparison__greater_than
-} BM0__ot;
+// returns zeroed memory like a fresh mapping would be, or 0 if the OS rejected a new chunk
+// zero lengths are rejected the same way mmap rejects them so a program behaves the same with and without an arena
+void* BM0__arena_allocate(BM0__arena* arena, unsigned long long length) {
+    unsigned long long size_class = BM0__get_arena_size_class(length);
+    unsigned long long block_length = (unsigned long long)BM0__define__arena_minimum_block_length << size_class;
+    void* output;
+    void* chunk;
 
-// syscall type
-typedef enum BM0__st {
-    BM0__st__read,
-    BM0__st__write,
-    BM0__st__open,
-    BM0__st__close,
-    BM0__st__stat,
-    BM0__st__fstat
-} BM0__st;
+    if (length == 0) {
+        return 0;
+    }
+    if (size_class == BM0__define__arena_size_class_count) {
+        return BM0__arena_allocate_large(arena, length);
+    }
 
-BM0__buffer BM0__run_byte_machine(BM0__et* error, BM0__buffer input_buffers_buffer, BM0__boolean final_debug_info) {
-    // output
-    BM0__buffer output = BM0__create_null_buffer();
+    // reuse a freed block
+    if (arena->p_free_lists[size_class] != 0) {
+        output = arena->p_free_lists[size_class];
+        arena->p_free_lists[size_class] = *(void**)output;
+        BM0__zero_bytes(output, length);
 
-    // allocations
-    BM0__allocations* allocations = (BM0__allocations*)BM0__allocate(sizeof(BM0__buffer) * BM0__define__max_allocation_count);
+        return output;
+    }
 
-    // registers
-    void* regs[BM0__define__register_count];
+    // move to the next chunk, mapping one if none are left over from before a reset
+    if (arena->p_current_chunk == 0 || arena->p_current_chunk_used + block_length > BM0__define__arena_chunk_length) {
+        if (arena->p_current_chunk != 0 && *(void**)arena->p_current_chunk != 0) {
+            chunk = *(void**)arena->p_current_chunk;
+        } else {
+            chunk = BM0__allocate(BM0__define__arena_chunk_length);
+            if (chunk == 0) {
+                return 0;
+            }
 
-    // temps
-    struct stat stat_temporary;
+            // append chunk
+            *(void**)chunk = 0;
+            if (arena->p_current_chunk != 0) {
+                *(void**)arena->p_current_chunk = chunk;
+            } else {
+                arena->p_chunks = chunk;
+            }
+        }
 
-    // check input for at least one buffer
-    if ((input_buffers_buffer.p_length < sizeof(BM0__buffer) && input_buffers_buffer.p_length > (sizeof(BM0__buffer) * BM0__define__max_input_sub_buffer_count)) || input_buffers_buffer.p_length % sizeof(BM0__buffer) != 0) {
-        *error = BM0__et__invalid_input_buffer;
+        arena->p_current_chunk = chunk;
+        arena->p_current_chunk_used = BM0__define__arena_minimum_block_length;
+    }
 
-        return output;
+    // carve block
+    output = arena->p_current_chunk + arena->p_current_chunk_used;
+    arena->p_current_chunk_used += block_length;
+    BM0__zero_bytes(output, length);
+
+    return output;
+}
+
+void BM0__arena_deallocate(BM0__arena* arena, void* address, unsigned long long length) {
+    unsigned long long size_class = BM0__get_arena_size_class(length);
+
+    if (size_class == BM0__define__arena_size_class_count) {
+        BM0__arena_deallocate_large(arena, address);
+
+        return;
     }
 
-    // setup
-    *error = BM0__et__no_error;
-    regs[BM0__rt__instruction_pointer_register] = ((BM0__buffer*)(input_buffers_buffer.p_data))[0].p_data; // setup instruction pointer
-    regs[BM0__rt__input_buffers_pointer_register] = input_buffers_buffer.p_data; // setup the pointer to the input buffers
-    regs[BM0__rt__input_buffers_length_register] = (void*)input_buffers_buffer.p_length; // setup the length of the input buffers
-    BM0__create_null_allocations(allocations);
+    // push block onto its free list
+    *(void**)address = arena->p_free_lists[size_class];
+    arena->p_free_lists[size_class] = address;
 
-    // process instructions
-    while (BM0__boolean__true) {
-        // clear necessary registers
-        regs[BM0__rt__instruction_parameter_register_0] = 0;
-        regs[BM0__rt__instruction_parameter_register_1] = 0;
-        regs[BM0__rt__instruction_parameter_register_2] = 0;
-        regs[BM0__rt__instruction_parameter_register_3] = 0;
-        regs[BM0__rt__instruction_parameter_register_4] = 0;
-        regs[BM0__rt__instruction_parameter_register_5] = 0;
-        regs[BM0__rt__instruction_parameter_register_6] = 0;
-        regs[BM0__rt__instruction_parameter_register_7] = 0;
-
-        // get instruction ID
-        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register], 2, (void*)&regs[BM0__rt__instruction_ID_register]);
-
-        // go to proper instruction's operations
-        switch ((BM0__it)(unsigned short)(unsigned long long)regs[BM0__rt__instruction_ID_register]) {
-        case BM0__it__quit:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-
-            // perform action
-            output.p_data = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]];
-            output.p_length = (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]];
-
-            if (final_debug_info == BM0__boolean__true) {
-                printf("Instruction 'quit' called, dumping registers, dumping output and quitting byte machine...\n");
-
-                for (unsigned long long i = 0; i < 32; i++) {
-                    printf("\t[ ");
-
-                    for (unsigned long long j = 0; j < 8; j++) {
-                        printf("%llu ", (unsigned long long)regs[(i * 8) + j]);
-                    }
-
-                    printf("]\n");
-                }
+    return;
+}
 
-                printf("\tOutput: [ %llu, %llu ]\n", (unsigned long long)output.p_data, (unsigned long long)output.p_length);
-            }
+// frees every allocation at once, chunks are kept for the next run so small allocations do not need the OS again
+void BM0__reset_arena(BM0__arena* arena) {
+    while (arena->p_large_allocations != 0) {
+        BM0__arena_deallocate_large(arena, (void*)(((BM0__arena_large_header*)arena->p_large_allocations) + 1));
+    }
+    for (unsigned long long i = 0; i < BM0__define__arena_size_class_count; i++) {
+        arena->p_free_lists[i] = 0;
+    }
+    arena->p_current_chunk = arena->p_chunks;
+    arena->p_current_chunk_used = BM0__define__arena_minimum_block_length;
 
-            return output;
-        case BM0__it__write_register:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 8, &regs[BM0__rt__instruction_parameter_register_1]);
-
-            // perform action
-            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]] = regs[BM0__rt__instruction_parameter_register_1];
-
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__write_register);
-
-            break;
-        case BM0__it__allocate:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
-
-            // perform action
-            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = (void*)BM0__allocate_buffer_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
-            if (regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] < (void*)(unsigned long long)(unsigned short)BM0__define__max_allocation_count) {
-                // allocate
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_data;
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_length);
-            } else {
-                // make registers null
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = 0;
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = 0;
-            }
+    return;
+}
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__allocate);
+void BM0__destroy_arena(BM0__arena* arena) {
+    void* next;
 
-            break;
-        case BM0__it__deallocate:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+    BM0__reset_arena(arena);
+    while (arena->p_chunks != 0) {
+        next = *(void**)arena->p_chunks;
+        BM0__deallocate(arena->p_chunks, BM0__define__arena_chunk_length);
+        arena->p_chunks = next;
+    }
+    *arena = BM0__create_arena();
 
-            // perform action
-            BM0__deallocate_buffer_from_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
+    return;
+}
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__deallocate);
+/* Asynchronous IO */
+// io type
+typedef enum BM0__iot {
+    BM0__iot__read,
+    BM0__iot__write,
+    BM0__iot__open,
+    BM0__iot__close
+} BM0__iot;
+
+// one queued operation as laid out in byte machine memory
+typedef struct BM0__io_request {
+    unsigned long long p_type; // BM0__iot
+    unsigned long long p_file_descriptor; // unused by open
+    void* p_buffer; // path for open
+    unsigned long long p_length; // flags for open
+    unsigned long long p_offset; // all bits set to use and move the file position
+    unsigned long long p_user_data; // handed back with the completion
+} BM0__io_request;
+
+// one finished operation as laid out in byte machine memory
+typedef struct BM0__io_completion {
+    unsigned long long p_user_data;
+    unsigned long long p_result; // what the syscall returned, negative error numbers on failure
+} BM0__io_completion;
+
+// an operation in flight, slots are numbered so completions can find their request
+typedef struct BM0__io_slot {
+    BM0__io_request p_request;
+    unsigned long long p_next_free_slot;
+} BM0__io_slot;
+
+typedef struct BM0__io_queue {
+    // slots
+    BM0__io_slot p_slots[BM0__define__io_slot_count];
+    unsigned long long p_free_slot; // BM0__define__io_slot_count when every slot is in flight
+    unsigned long long p_in_flight;
+
+    // reads reaped by the last completion, so callers can tell if their memory changed
+    void* p_last_read_start;
+    void* p_last_read_end;
+
+    // io_uring, the file descriptor is -1 when the thread pool is used instead
+    int p_ring_file_descriptor;
+    void* p_submission_ring;
+    unsigned long long p_submission_ring_length;
+    void* p_completion_ring;
+    unsigned long long p_completion_ring_length;
+    struct io_uring_sqe* p_submission_entries;
+    unsigned long long p_submission_entries_length;
+    unsigned int* p_submission_tail;
+    unsigned int* p_submission_mask;
+    unsigned int* p_submission_array;
+    unsigned int p_submission_pending;
+    unsigned int* p_completion_head;
+    unsigned int* p_completion_tail;
+    unsigned int* p_completion_mask;
+    struct io_uring_cqe* p_completion_entries;
+
+    // thread pool, slots waiting to run and finished slots are both kept in rings of slot indices
+    pthread_mutex_t p_lock;
+    pthread_cond_t p_work_ready;
+    pthread_cond_t p_work_done;
+    pthread_t p_threads[BM0__define__io_thread_count];
+    unsigned long long p_thread_count;
+    BM0__boolean p_stopping;
+    unsigned long long p_waiting[BM0__define__io_slot_count];
+    unsigned long long p_waiting_head;
+    unsigned long long p_waiting_count;
+    unsigned long long p_finished[BM0__define__io_slot_count];
+    unsigned long long p_finished_results[BM0__define__io_slot_count];
+    unsigned long long p_finished_head;
+    unsigned long long p_finished_count;
+} BM0__io_queue;
+
+// runs one request on the calling thread, used by the thread pool
+unsigned long long BM0__perform_io_request(BM0__io_request* request) {
+    long long output;
+
+    switch ((BM0__iot)(*request).p_type) {
+    case BM0__iot__read:
+        if ((*request).p_offset == ~0ull) {
+            output = read((int)(*request).p_file_descriptor, (*request).p_buffer, (size_t)(*request).p_length);
+        } else {
+            output = pread((int)(*request).p_file_descriptor, (*request).p_buffer, (size_t)(*request).p_length, (off_t)(*request).p_offset);
+        }
 
-            break;
-        case BM0__it__buffer_to_register:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        break;
+    case BM0__iot__write:
+        if ((*request).p_offset == ~0ull) {
+            output = write((int)(*request).p_file_descriptor, (*request).p_buffer, (size_t)(*request).p_length);
+        } else {
+            output = pwrite((int)(*request).p_file_descriptor, (*request).p_buffer, (size_t)(*request).p_length, (off_t)(*request).p_offset);
+        }
 
-            // perform action
-            if ((unsigned long long)regs[BM0__rt__instruction_parameter_register_1] <= sizeof(unsigned long long)) {
-                BM0__copy_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (void*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
-            } else {
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__invalid_byte_transfer_size;
-            }
+        break;
+    case BM0__iot__open:
+        output = open((const char*)(*request).p_buffer, (int)(*request).p_length, 0644);
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__buffer_to_register);
+        break;
+    case BM0__iot__close:
+        output = close((int)(*request).p_file_descriptor);
 
-            break;
-        case BM0__it__register_to_register:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        break;
+    default:
+        return (unsigned long long)(long long)-EINVAL;
+    }
+
+    // report errors the same way io_uring does
+    if (output < 0) {
+        return (unsigned long long)(long long)-errno;
+    }
 
-            // perform action
-            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]];
+    return (unsigned long long)output;
+}
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_register);
+void* BM0__run_io_thread(void* queue_pointer) {
+    BM0__io_queue* queue = (BM0__io_queue*)queue_pointer;
+    unsigned long long slot;
+    unsigned long long result;
 
+    pthread_mutex_lock(&(*queue).p_lock);
+    while (BM0__boolean__true) {
+        // wait for work
+        while ((*queue).p_waiting_count == 0 && (*queue).p_stopping == BM0__boolean__false) {
+            pthread_cond_wait(&(*queue).p_work_ready, &(*queue).p_lock);
+        }
+        if ((*queue).p_waiting_count == 0) {
             break;
-        case BM0__it__register_to_buffer:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        }
 
-            // perform action
-            if ((unsigned long long)regs[BM0__rt__instruction_parameter_register_1] <= sizeof(unsigned long long)) {
-                BM0__copy_bytes((void*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[BM0__rt__instruction_parameter_register_1], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
-            } else {
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__invalid_byte_transfer_size;
-            }
-
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_buffer);
-
-            break;
-        case BM0__it__operate:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 7, 1, &regs[BM0__rt__instruction_parameter_register_5]);
-
-            // perform action
-            if ((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1] < (unsigned char)32) {
-                // use if wanting byte machine to look for bit and get operation directly from operation parameter
-                regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__false;
-                regs[BM0__rt__instruction_parameter_register_7] = (void*)regs[BM0__rt__instruction_parameter_register_2];
-            } else if ((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1] < (unsigned char)64) {
-                // use if wanting byte machine to look for bit and get operation from operation parameter's specified register
-                regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__false;
-                regs[BM0__rt__instruction_parameter_register_7] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]];
-            } else if ((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1] < (unsigned char)128) {
-                // use if wanting byte machine to always perform operation and get operation directly from operation parameter
-                regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__true;
-                regs[BM0__rt__instruction_parameter_register_7] = (void*)regs[BM0__rt__instruction_parameter_register_2];
-            } else {
-                // use if wanting byte machine to always perform operation and get operation from operation parameter's specified register
-                regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__true;
-                regs[BM0__rt__instruction_parameter_register_7] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]];
-            }
-
-            if (regs[BM0__rt__instruction_parameter_register_6] || ((unsigned long long)(((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]) & (unsigned long long)((1 << (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]))) > 0)) {
-                switch ((BM0__ot)(unsigned short)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]) {
-                case BM0__ot__binary__right_shift:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] >> (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__binary__left_shift:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] << (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__binary__not:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)(~(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]]);
-                    break;
-                case BM0__ot__binary__and:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] & (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__binary__or:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] | (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__binary__xor:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] ^ (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__integer__add:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] + (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__integer__subtract:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] - (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__integer__multiply:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] * (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__integer__divide:
-                    if ((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]] != 0) {
-                        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] / (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    } else {
-                        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__division_by_zero_attempted;
-                    }
-
-                    break;
-                case BM0__ot__integer__modulous:
-                    if ((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]] != 0) {
-                        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] % (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    } else {
-                        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__modulus_by_zero_attempted;
-                    }
-
-                    break;
-                case BM0__ot__comparison__less_than:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)(unsigned long long)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] < (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__comparison__equal_to:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)(unsigned long long)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] == (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__comparison__not_equal_to:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)(unsigned long long)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] != (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                case BM0__ot__comparison__greater_than:
-                    regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]] = (void*)(unsigned long long)((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] > (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]]);
-                    break;
-                // in case there is an invalid / unimplemented operation ID
-                default:
-                    *error = BM0__et__unimplemented_operation;
+        // take work
+        slot = (*queue).p_waiting[(*queue).p_waiting_head];
+        (*queue).p_waiting_head = ((*queue).p_waiting_head + 1) % BM0__define__io_slot_count;
+        (*queue).p_waiting_count--;
+
+        // run it unlocked
+        pthread_mutex_unlock(&(*queue).p_lock);
+        result = BM0__perform_io_request(&(*queue).p_slots[slot].p_request);
+        pthread_mutex_lock(&(*queue).p_lock);
+
+        // hand back result
+        (*queue).p_finished[((*queue).p_finished_head + (*queue).p_finished_count) % BM0__define__io_slot_count] = slot;
+        (*queue).p_finished_results[((*queue).p_finished_head + (*queue).p_finished_count) % BM0__define__io_slot_count] = result;
+        (*queue).p_finished_count++;
+        pthread_cond_signal(&(*queue).p_work_done);
+    }
+    pthread_mutex_unlock(&(*queue).p_lock);
 
-                    return output;
-                }
-            }
+    return 0;
+}
+
+BM0__boolean BM0__open_io_ring(BM0__io_queue* queue) {
+    struct io_uring_params parameters;
+    int ring;
+
+    // create ring
+    BM0__zero_bytes(&parameters, sizeof(parameters));
+    ring = (int)syscall(__NR_io_uring_setup, BM0__define__io_ring_entry_count, &parameters);
+    if (ring < 0) {
+        return BM0__boolean__false;
+    }
+
+    // map rings, newer kernels share one mapping for both
+    (*queue).p_submission_ring_length = parameters.sq_off.array + (parameters.sq_entries * sizeof(unsigned int));
+    (*queue).p_completion_ring_length = parameters.cq_off.cqes + (parameters.cq_entries * sizeof(struct io_uring_cqe));
+    if (parameters.features & IORING_FEAT_SINGLE_MMAP) {
+        if ((*queue).p_completion_ring_length > (*queue).p_submission_ring_length) {
+            (*queue).p_submission_ring_length = (*queue).p_completion_ring_length;
+        }
+        (*queue).p_completion_ring_length = 0;
+    }
+    (*queue).p_submission_entries_length = parameters.sq_entries * sizeof(struct io_uring_sqe);
+    (*queue).p_submission_ring = mmap(0, (*queue).p_submission_ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+    (*queue).p_completion_ring = (*queue).p_submission_ring;
+    if ((*queue).p_completion_ring_length != 0 && (*queue).p_submission_ring != MAP_FAILED) {
+        (*queue).p_completion_ring = mmap(0, (*queue).p_completion_ring_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+    }
+    (*queue).p_submission_entries = (struct io_uring_sqe*)mmap(0, (*queue).p_submission_entries_length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+
+    // give up on any failure
+    if ((*queue).p_submission_ring == MAP_FAILED || (*queue).p_completion_ring == MAP_FAILED || (*queue).p_submission_entries == MAP_FAILED) {
+        if ((*queue).p_submission_ring != MAP_FAILED) {
+            munmap((*queue).p_submission_ring, (*queue).p_submission_ring_length);
+        }
+        if ((*queue).p_completion_ring_length != 0 && (*queue).p_completion_ring != MAP_FAILED) {
+            munmap((*queue).p_completion_ring, (*queue).p_completion_ring_length);
+        }
+        if ((*queue).p_submission_entries != MAP_FAILED) {
+            munmap((*queue).p_submission_entries, (*queue).p_submission_entries_length);
+        }
+        close(ring);
+
+        return BM0__boolean__false;
+    }
+
+    // find ring fields
+    (*queue).p_ring_file_descriptor = ring;
+    (*queue).p_submission_tail = (unsigned int*)((*queue).p_submission_ring + parameters.sq_off.tail);
+    (*queue).p_submission_mask = (unsigned int*)((*queue).p_submission_ring + parameters.sq_off.ring_mask);
+    (*queue).p_submission_array = (unsigned int*)((*queue).p_submission_ring + parameters.sq_off.array);
+    (*queue).p_submission_pending = 0;
+    (*queue).p_completion_head = (unsigned int*)((*queue).p_completion_ring + parameters.cq_off.head);
+    (*queue).p_completion_tail = (unsigned int*)((*queue).p_completion_ring + parameters.cq_off.tail);
+    (*queue).p_completion_mask = (unsigned int*)((*queue).p_completion_ring + parameters.cq_off.ring_mask);
+    (*queue).p_completion_entries = (struct io_uring_cqe*)((*queue).p_completion_ring + parameters.cq_off.cqes);
+
+    return BM0__boolean__true;
+}
+
+// uses io_uring when the kernel allows it, otherwise starts the thread pool, returns 0 if neither works
+BM0__io_queue* BM0__create_io_queue() {
+    BM0__io_queue* queue = (BM0__io_queue*)BM0__allocate(sizeof(BM0__io_queue));
+
+    if (queue == 0) {
+        return 0;
+    }
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__operate);
+    // chain slots
+    for (unsigned long long i = 0; i < BM0__define__io_slot_count; i++) {
+        (*queue).p_slots[i].p_next_free_slot = i + 1;
+    }
+    (*queue).p_free_slot = 0;
+    (*queue).p_in_flight = 0;
+    (*queue).p_ring_file_descriptor = -1;
+    (*queue).p_thread_count = 0;
+
+#ifndef BM0__disable__io_uring
+    if (BM0__open_io_ring(queue)) {
+        return queue;
+    }
+#endif
 
+    // fall back to threads
+    pthread_mutex_init(&(*queue).p_lock, 0);
+    pthread_cond_init(&(*queue).p_work_ready, 0);
+    pthread_cond_init(&(*queue).p_work_done, 0);
+    (*queue).p_stopping = BM0__boolean__false;
+    for (unsigned long long i = 0; i < BM0__define__io_thread_count; i++) {
+        if (pthread_create(&(*queue).p_threads[i], 0, BM0__run_io_thread, queue) != 0) {
             break;
-        case BM0__it__do_x86_64_linux_syscall_limited:
-            // read parameters
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 7, 1, &regs[BM0__rt__instruction_parameter_register_5]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 8, 1, &regs[BM0__rt__instruction_parameter_register_6]);
-            BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 9, 1, &regs[BM0__rt__instruction_parameter_register_7]);
-            
-            // perform action
-            switch ((BM0__ot)(unsigned short)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]) {
-            case BM0__st__read:
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]] = (void*)(unsigned long long)read((unsigned int)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]], (size_t)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]]);
+        }
+        (*queue).p_thread_count++;
+    }
+    if ((*queue).p_thread_count == 0) {
+        pthread_cond_destroy(&(*queue).p_work_done);
+        pthread_cond_destroy(&(*queue).p_work_ready);
+        pthread_mutex_destroy(&(*queue).p_lock);
+        BM0__deallocate(queue, sizeof(BM0__io_queue));
 
-                break;
-            case BM0__st__write:
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]] = (void*)(unsigned long long)write((unsigned int)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]], (size_t)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]]);
+        return 0;
+    }
 
-                break;
-            case BM0__st__open:
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]] = (void*)(unsigned long long)open((const char*)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], (int)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+    return queue;
+}
 
-                break;
-            case BM0__st__close:
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]] = (void*)(unsigned long long)close((int)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+// hands queued io_uring entries to the kernel, optionally waiting for completions
+void BM0__enter_io_ring(BM0__io_queue* queue, unsigned int wait_count) {
+    int submitted;
 
-                break;
-            case BM0__st__stat:
-                regs[BM0__rt__instruction_parameter_register_7] = (void*)(unsigned long long)stat((const char*)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], &stat_temporary);
+    submitted = (int)syscall(__NR_io_uring_enter, (*queue).p_ring_file_descriptor, (*queue).p_submission_pending, wait_count, wait_count > 0 ? IORING_ENTER_GETEVENTS : 0, 0, 0);
+    if (submitted > 0) {
+        (*queue).p_submission_pending -= (unsigned int)submitted;
+    }
 
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (void*)(unsigned long long)stat_temporary.st_size;
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)(unsigned long long)stat_temporary.st_mode;
-                
-                break;
-            case BM0__st__fstat:
-                regs[BM0__rt__instruction_parameter_register_7] = (void*)(unsigned long long)fstat((int)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], &stat_temporary);
+    return;
+}
 
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (void*)(unsigned long long)stat_temporary.st_size;
-                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)(unsigned long long)stat_temporary.st_mode;
-                
-                break;
-            default:
-                *error = BM0__et__unimplemented_syscall;
+// queues as many requests as there are free slots, returns how many were queued
+unsigned long long BM0__submit_io(BM0__io_queue* queue, BM0__io_request* requests, unsigned long long count) {
+    unsigned long long slot;
+    unsigned int tail;
+    struct io_uring_sqe* entry;
+    unsigned long long output = 0;
+
+    if ((*queue).p_ring_file_descriptor == -1) {
+        pthread_mutex_lock(&(*queue).p_lock);
+    }
 
-                return output;
+    while (output < count && (*queue).p_free_slot != BM0__define__io_slot_count) {
+        // make room in the submission ring
+        if ((*queue).p_ring_file_descriptor != -1 && (*queue).p_submission_pending == BM0__define__io_ring_entry_count) {
+            BM0__enter_io_ring(queue, 0);
+            if ((*queue).p_submission_pending == BM0__define__io_ring_entry_count) {
+                break;
             }
+        }
+
+        // take slot
+        slot = (*queue).p_free_slot;
+        (*queue).p_free_slot = (*queue).p_slots[slot].p_next_free_slot;
+        BM0__copy_bytes(&requests[output], sizeof(BM0__io_request), &(*queue).p_slots[slot].p_request);
+        (*queue).p_in_flight++;
+        output++;
+
+        // hand to a thread
+        if ((*queue).p_ring_file_descriptor == -1) {
+            (*queue).p_waiting[((*queue).p_waiting_head + (*queue).p_waiting_count) % BM0__define__io_slot_count] = slot;
+            (*queue).p_waiting_count++;
+            pthread_cond_signal(&(*queue).p_work_ready);
+
+            continue;
+        }
+
+        // fill entry, unknown types become no-ops that fail once reaped
+        tail = *(*queue).p_submission_tail;
+        entry = &(*queue).p_submission_entries[tail & *(*queue).p_submission_mask];
+        BM0__zero_bytes(entry, sizeof(struct io_uring_sqe));
+        entry->user_data = slot;
+        switch ((BM0__iot)(*queue).p_slots[slot].p_request.p_type) {
+        case BM0__iot__read:
+        case BM0__iot__write:
+            entry->opcode = (*queue).p_slots[slot].p_request.p_type == BM0__iot__read ? IORING_OP_READ : IORING_OP_WRITE;
+            entry->fd = (int)(*queue).p_slots[slot].p_request.p_file_descriptor;
+            entry->addr = (unsigned long long)(*queue).p_slots[slot].p_request.p_buffer;
+            // clamped like read and write clamp it, so the completion reports the short count instead of a truncated length
+            entry->len = (*queue).p_slots[slot].p_request.p_length < BM0__define__io_max_length ? (unsigned int)(*queue).p_slots[slot].p_request.p_length : BM0__define__io_max_length;
+            entry->off = (*queue).p_slots[slot].p_request.p_offset;
 
-            // change instruction index
-            BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__do_x86_64_linux_syscall_limited);
+            break;
+        case BM0__iot__open:
+            entry->opcode = IORING_OP_OPENAT;
+            entry->fd = AT_FDCWD;
+            entry->addr = (unsigned long long)(*queue).p_slots[slot].p_request.p_buffer;
+            entry->len = 0644;
+            entry->open_flags = (unsigned int)(*queue).p_slots[slot].p_request.p_length;
+
+            break;
+        case BM0__iot__close:
+            entry->opcode = IORING_OP_CLOSE;
+            entry->fd = (int)(*queue).p_slots[slot].p_request.p_file_descriptor;
 
             break;
-        // in case no instruction is matched
         default:
-            *error = BM0__et__unimplemented_instruction_ID;
+            entry->opcode = IORING_OP_NOP;
 
-            return output;
+            break;
         }
+        (*queue).p_submission_array[tail & *(*queue).p_submission_mask] = tail & *(*queue).p_submission_mask;
+        __atomic_store_n((*queue).p_submission_tail, tail + 1, __ATOMIC_RELEASE);
+        (*queue).p_submission_pending++;
+    }
+
+    // submit
+    if ((*queue).p_ring_file_descriptor == -1) {
+        pthread_mutex_unlock(&(*queue).p_lock);
+    } else if ((*queue).p_submission_pending > 0) {
+        BM0__enter_io_ring(queue, 0);
     }
 
-    // unreachable, but makes compiler happy
     return output;
 }
 
-/* Create Instructions & Data */
-unsigned long long BM0__write_instruction__get_instruction_ilt(BM0__it opcode) {
-    switch (opcode) {
-    case BM0__it__quit:
-        return BM0__ilt__quit;
-    case BM0__it__write_register:
-        return BM0__ilt__write_register;
-    case BM0__it__allocate:
-        return BM0__ilt__allocate;
-    case BM0__it__deallocate:
-        return BM0__ilt__deallocate;
-    case BM0__it__buffer_to_register:
-        return BM0__ilt__buffer_to_register;
-    case BM0__it__register_to_register:
-        return BM0__ilt__register_to_register;
-    case BM0__it__register_to_buffer:
-        return BM0__ilt__register_to_buffer;
-    case BM0__it__operate:
-        return BM0__ilt__operate;
-    case BM0__it__do_x86_64_linux_syscall_limited:
-        return BM0__ilt__do_x86_64_linux_syscall_limited;
-    default:
-        return 0;
+// records one reaped operation and frees its slot
+void BM0__finish_io_slot(BM0__io_queue* queue, unsigned long long slot, unsigned long long result, BM0__io_completion* completion) {
+    BM0__io_request* request = &(*queue).p_slots[slot].p_request;
+
+    // unknown types were never run
+    if ((*request).p_type > BM0__iot__close) {
+        result = (unsigned long long)(long long)-EINVAL;
     }
-}
+    (*completion).p_user_data = (*request).p_user_data;
+    (*completion).p_result = result;
 
-void* BM0__write_instruction__write_buffer_to_program(void* destination, BM0__buffer data) {
-    BM0__copy_bytes(data.p_data, data.p_length, destination);
+    // widen the range of memory written by reads
+    if ((*request).p_type == BM0__iot__read && (long long)result > 0) {
+        if ((*queue).p_last_read_start == (*queue).p_last_read_end || (*request).p_buffer < (*queue).p_last_read_start) {
+            (*queue).p_last_read_start = (*request).p_buffer;
+        }
+        if ((*request).p_buffer + result > (*queue).p_last_read_end) {
+            (*queue).p_last_read_end = (*request).p_buffer + result;
+        }
+    }
 
-    return destination + data.p_length;
+    // give slot back
+    (*queue).p_slots[slot].p_next_free_slot = (*queue).p_free_slot;
+    (*queue).p_free_slot = slot;
+    (*queue).p_in_flight--;
+
+    return;
 }
 
-void* BM0__write_instruction__quit(void* destination, unsigned char buffer_pointer_source_register, unsigned char buffer_length_source_register) {
-    unsigned short opcode = BM0__it__quit;
+// waits for at least minimum_count operations (capped to those in flight) and reaps up to maximum_count, returns how many were reaped
+unsigned long long BM0__complete_io(BM0__io_queue* queue, BM0__io_completion* completions, unsigned long long maximum_count, unsigned long long minimum_count) {
+    unsigned int head;
+    unsigned long long output = 0;
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&buffer_pointer_source_register, 1, destination + 2);
-    BM0__copy_bytes(&buffer_length_source_register, 1, destination + 3);
+    (*queue).p_last_read_start = 0;
+    (*queue).p_last_read_end = 0;
+    if (minimum_count > (*queue).p_in_flight) {
+        minimum_count = (*queue).p_in_flight;
+    }
+    if (minimum_count > maximum_count) {
+        minimum_count = maximum_count;
+    }
 
-    return destination + (unsigned long long)BM0__ilt__quit;
-}
+    // thread pool
+    if ((*queue).p_ring_file_descriptor == -1) {
+        pthread_mutex_lock(&(*queue).p_lock);
+        while ((*queue).p_finished_count < minimum_count) {
+            pthread_cond_wait(&(*queue).p_work_done, &(*queue).p_lock);
+        }
+        while (output < maximum_count && (*queue).p_finished_count > 0) {
+            BM0__finish_io_slot(queue, (*queue).p_finished[(*queue).p_finished_head], (*queue).p_finished_results[(*queue).p_finished_head], &completions[output]);
+            (*queue).p_finished_head = ((*queue).p_finished_head + 1) % BM0__define__io_slot_count;
+            (*queue).p_finished_count--;
+            output++;
+        }
+        pthread_mutex_unlock(&(*queue).p_lock);
 
-void* BM0__write_instruction__write_register(void* destination, unsigned char destination_register, unsigned long long value) {
-    unsigned short opcode = BM0__it__write_register;
+        return output;
+    }
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&destination_register, 1, destination + 2);
-    BM0__copy_bytes(&value, sizeof(unsigned long long), destination + 3);
+    // io_uring
+    head = *(*queue).p_completion_head;
+    while ((unsigned long long)(__atomic_load_n((*queue).p_completion_tail, __ATOMIC_ACQUIRE) - head) < minimum_count) {
+        BM0__enter_io_ring(queue, (unsigned int)(minimum_count - (__atomic_load_n((*queue).p_completion_tail, __ATOMIC_ACQUIRE) - head)));
+    }
+    while (output < maximum_count && head != __atomic_load_n((*queue).p_completion_tail, __ATOMIC_ACQUIRE)) {
+        BM0__finish_io_slot(queue, (*queue).p_completion_entries[head & *(*queue).p_completion_mask].user_data, (unsigned long long)(long long)(*queue).p_completion_entries[head & *(*queue).p_completion_mask].res, &completions[output]);
+        head++;
+        output++;
+    }
+    __atomic_store_n((*queue).p_completion_head, head, __ATOMIC_RELEASE);
 
-    return destination + (unsigned long long)BM0__ilt__write_register;
+    return output;
 }
 
-void* BM0__write_instruction__allocate(void* destination, unsigned char allocation_size_register, unsigned char handle_destination_register, unsigned char pointer_destination_register, unsigned char length_destination_register) {
-    unsigned short opcode = BM0__it__allocate;
+// waits for everything in flight and throws the completions away, since buffers may still be written
+void BM0__drain_io_queue(BM0__io_queue* queue) {
+    BM0__io_completion discarded;
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&allocation_size_register, 1, destination + 2);
-    BM0__copy_bytes(&handle_destination_register, 1, destination + 3);
-    BM0__copy_bytes(&pointer_destination_register, 1, destination + 4);
-    BM0__copy_bytes(&length_destination_register, 1, destination + 5);
+    while ((*queue).p_in_flight > 0) {
+        BM0__complete_io(queue, &discarded, 1, 1);
+    }
 
-    return destination + (unsigned long long)BM0__ilt__allocate;
+    return;
 }
 
-void* BM0__write_instruction__deallocate(void* destination, unsigned char handle_register) {
-    unsigned short opcode = BM0__it__deallocate;
+// releases the kernel ring or threads once nothing is in flight
+void BM0__destroy_io_queue(BM0__io_queue* queue) {
+    BM0__drain_io_queue(queue);
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&handle_register, 1, destination + 2);
+    if ((*queue).p_ring_file_descriptor != -1) {
+        munmap((*queue).p_submission_entries, (*queue).p_submission_entries_length);
+        if ((*queue).p_completion_ring_length != 0) {
+            munmap((*queue).p_completion_ring, (*queue).p_completion_ring_length);
+        }
+        munmap((*queue).p_submission_ring, (*queue).p_submission_ring_length);
+        close((*queue).p_ring_file_descriptor);
+    } else {
+        pthread_mutex_lock(&(*queue).p_lock);
+        (*queue).p_stopping = BM0__boolean__true;
+        pthread_cond_broadcast(&(*queue).p_work_ready);
+        pthread_mutex_unlock(&(*queue).p_lock);
+        for (unsigned long long i = 0; i < (*queue).p_thread_count; i++) {
+            pthread_join((*queue).p_threads[i], 0);
+        }
+        pthread_cond_destroy(&(*queue).p_work_done);
+        pthread_cond_destroy(&(*queue).p_work_ready);
+        pthread_mutex_destroy(&(*queue).p_lock);
+    }
+    BM0__deallocate(queue, sizeof(BM0__io_queue));
 
-    return destination + (unsigned long long)BM0__ilt__deallocate;
+    return;
 }
 
-void* BM0__write_instruction__buffer_to_register(void* destination, unsigned char source_pointer_register, unsigned char byte_count, unsigned char destination_register) {
-    unsigned short opcode = BM0__it__buffer_to_register;
+/* Allocation Management */
+// allocation type
+typedef enum BM0__att {
+    BM0__att__buffer, // from the allocate instruction
+    BM0__att__mapping, // from the mmap syscall, or mapped on its own and received from a channel
+    BM0__att__released_arena_allocation, // a large arena allocation received from a channel, freed together with its header
+    BM0__att__hash_table // from hash_table_operate, mapped on its own
+} BM0__att;
+
+// freed slots hold a null pointer and the index of the next freed slot in place of their length, slots past the used count have never been handed out
+typedef struct BM0__allocations {
+    BM0__buffer* p_buffers;
+    unsigned char* p_types; // BM0__att per slot
+    unsigned long long p_slot_count; // the maximum amount of live allocations
+    unsigned long long p_live_count;
+    unsigned long long p_used_slot_count; // so resetting only has to look at slots that were handed out
+    unsigned long long p_free_slot; // p_slot_count when no handed out slot has been freed
+    BM0__arena* p_arena; // zero to map every allocation on its own
+    BM0__io_queue* p_io_queue; // created by the first submitted io request
+    struct BM0__channel* p_channels[BM0__define__max_channel_count]; // zero unless a channel is attached to the context, kept between runs
+    struct BM0__siblings* p_siblings; // zero until the machine spawns a thread, from then on the table is shared and guarded by the lock
+    pthread_mutex_t p_lock;
+    unsigned long long p_policy; // BM0__apt bits the allocate instruction uses, kept between runs
+#ifdef BM0__enable__profiler
+    struct BM0__profile* p_profile; // zero unless a profile is attached to the context
+#endif
+#ifdef BM0__enable__trace
+    struct BM0__trace* p_trace; // zero unless a trace is attached to the context
+#endif
+} BM0__allocations;
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&source_pointer_register, 1, destination + 2);
-    BM0__copy_bytes(&byte_count, 1, destination + 3);
-    BM0__copy_bytes(&destination_register, 1, destination + 4);
+BM0__boolean BM0__check_allocation_exists(BM0__allocations* allocations, unsigned long long handle) {
+    return (BM0__boolean)((*allocations).p_buffers[handle].p_data == 0);
+}
 
-    return destination + (unsigned long long)BM0__ilt__buffer_to_register;
+unsigned long long BM0__get_allocations_length(unsigned long long slot_count) {
+    return sizeof(BM0__allocations) + ((sizeof(BM0__buffer) + sizeof(unsigned char)) * slot_count);
 }
 
-void* BM0__write_instruction__register_to_register(void* destination, unsigned char source_register, unsigned char destination_register) {
-    unsigned short opcode = BM0__it__register_to_register;
+// slots and their types are stored right after the table in one mapping, which starts zeroed
+BM0__allocations* BM0__create_null_allocations(unsigned long long slot_count, BM0__arena* arena) {
+    BM0__allocations* allocations = (BM0__allocations*)BM0__allocate(BM0__get_allocations_length(slot_count));
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&source_register, 1, destination + 2);
-    BM0__copy_bytes(&destination_register, 1, destination + 3);
+    if (allocations == 0) {
+        return 0;
+    }
 
-    return destination + (unsigned long long)BM0__ilt__register_to_register;
-}
+    // setup table
+    (*allocations).p_buffers = (BM0__buffer*)(allocations + 1);
+    (*allocations).p_types = (unsigned char*)((*allocations).p_buffers + slot_count);
+    (*allocations).p_slot_count = slot_count;
+    (*allocations).p_live_count = 0;
+    (*allocations).p_used_slot_count = 0;
+    (*allocations).p_free_slot = slot_count;
+    (*allocations).p_arena = arena;
+    (*allocations).p_io_queue = 0;
+    for (unsigned long long i = 0; i < BM0__define__max_channel_count; i++) {
+        (*allocations).p_channels[i] = 0;
+    }
+    (*allocations).p_siblings = 0;
+    pthread_mutex_init(&(*allocations).p_lock, 0);
+    (*allocations).p_policy = BM0__apt__default;
+#ifdef BM0__enable__profiler
+    (*allocations).p_profile = 0;
+#endif
+#ifdef BM0__enable__trace
+    (*allocations).p_trace = 0;
+#endif
 
-void* BM0__write_instruction__register_to_buffer(void* destination, unsigned char source_register, unsigned char byte_count, unsigned char destination_pointer_register) {
-    unsigned short opcode = BM0__it__register_to_buffer;
+    return allocations;
+}
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&source_register, 1, destination + 2);
-    BM0__copy_bytes(&byte_count, 1, destination + 3);
-    BM0__copy_bytes(&destination_pointer_register, 1, destination + 4);
+// freed slots are reused first, then fresh handles count up from zero, returns the slot count when every slot is in use
+unsigned long long BM0__find_allocation_slot(BM0__allocations* allocations) {
+    if ((*allocations).p_free_slot != (*allocations).p_slot_count) {
+        return (*allocations).p_free_slot;
+    }
 
-    return destination + (unsigned long long)BM0__ilt__register_to_buffer;
+    return (*allocations).p_used_slot_count;
 }
 
-void* BM0__write_instruction__operate(void* destination, unsigned char flags_register_number, unsigned char required_flag_bit, unsigned char operation, unsigned char source_register_1, unsigned char source_register_2, unsigned char destination_register_1) {
-    unsigned short opcode = BM0__it__operate;
+void BM0__take_allocation_slot(BM0__allocations* allocations, unsigned long long handle) {
+    if (handle == (*allocations).p_free_slot) {
+        (*allocations).p_free_slot = (*allocations).p_buffers[handle].p_length;
+    } else {
+        (*allocations).p_used_slot_count++;
+    }
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&flags_register_number, 1, destination + 2);
-    BM0__copy_bytes(&required_flag_bit, 1, destination + 3);
-    BM0__copy_bytes(&operation, 1, destination + 4);
-    BM0__copy_bytes(&source_register_1, 1, destination + 5);
-    BM0__copy_bytes(&source_register_2, 1, destination + 6);
-    BM0__copy_bytes(&destination_register_1, 1, destination + 7);
+    return;
+}
 
-    return destination + (unsigned long long)BM0__ilt__operate;
+void BM0__give_back_allocation_slot(BM0__allocations* allocations, unsigned long long handle) {
+    (*allocations).p_buffers[handle].p_data = 0;
+    (*allocations).p_buffers[handle].p_length = (*allocations).p_free_slot;
+    (*allocations).p_types[handle] = BM0__att__buffer;
+    (*allocations).p_free_slot = handle;
+
+    return;
 }
 
-void* BM0__write_instruction__do_x86_64_linux_syscall_limited(void* destination, unsigned char syscall_number, unsigned char argument_1, unsigned char argument_2, unsigned char argument_3, unsigned char argument_4, unsigned char argument_5, unsigned char argument_6, unsigned char return_value_destination_register) {
-    unsigned short opcode = BM0__it__do_x86_64_linux_syscall_limited;
+void BM0__free_allocation(BM0__allocations* allocations, unsigned long long handle) {
+    if ((*allocations).p_types[handle] == BM0__att__mapping || (*allocations).p_types[handle] == BM0__att__hash_table) {
+        BM0__deallocate((*allocations).p_buffers[handle].p_data, (*allocations).p_buffers[handle].p_length);
+    } else if ((*allocations).p_types[handle] == BM0__att__released_arena_allocation) {
+        BM0__deallocate_released_arena_allocation((*allocations).p_buffers[handle].p_data);
+    } else if ((*allocations).p_arena != 0) {
+        BM0__arena_deallocate((*allocations).p_arena, (*allocations).p_buffers[handle].p_data, (*allocations).p_buffers[handle].p_length);
+    } else {
+        BM0__destroy_buffer((*allocations).p_buffers[handle]);
+    }
 
-    BM0__copy_bytes(&opcode, 2, destination);
-    BM0__copy_bytes(&syscall_number, 1, destination + 2);
+    return;
+}
+
+// empties the table for another run, live buffers are either freed or left alone like they are when the table is destroyed
+void BM0__reset_allocations(BM0__allocations* allocations, BM0__boolean free_buffers) {
+    if ((*allocations).p_io_queue != 0) {
+        BM0__drain_io_queue((*allocations).p_io_queue);
+    }
+    for (unsigned long long i = 0; i < (*allocations).p_used_slot_count; i++) {
+        if (free_buffers && (*allocations).p_buffers[i].p_data != 0) {
+            BM0__free_allocation(allocations, i);
+        }
+        (*allocations).p_buffers[i].p_data = 0;
+        (*allocations).p_buffers[i].p_length = 0;
+        (*allocations).p_types[i] = BM0__att__buffer;
+    }
+    (*allocations).p_live_count = 0;
+    (*allocations).p_used_slot_count = 0;
+    (*allocations).p_free_slot = (*allocations).p_slot_count;
+
+    return;
+}
+
+// only frees the table, live buffers stay valid since they may be part of the output
+void BM0__destroy_allocations(BM0__allocations* allocations) {
+    if ((*allocations).p_io_queue != 0) {
+        BM0__destroy_io_queue((*allocations).p_io_queue);
+    }
+    pthread_mutex_destroy(&(*allocations).p_lock);
+    BM0__deallocate(allocations, BM0__get_allocations_length((*allocations).p_slot_count));
+
+    return;
+}
+
+// instructions that change the table hold the lock while the machine has threads, a machine with one thread never takes it
+void BM0__lock_allocations(BM0__allocations* allocations) {
+    if ((*allocations).p_siblings != 0) {
+        pthread_mutex_lock(&(*allocations).p_lock);
+    }
+
+    return;
+}
+
+void BM0__unlock_allocations(BM0__allocations* allocations) {
+    if ((*allocations).p_siblings != 0) {
+        pthread_mutex_unlock(&(*allocations).p_lock);
+    }
+
+    return;
+}
+
+// allocations with a policy are mapped on their own instead of coming from the arena
+unsigned long long BM0__allocate_buffer_to_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long allocation_size, unsigned long long policy) {
+    unsigned long long handle = BM0__find_allocation_slot(allocations);
+
+    // no empty buffers are found
+    if (handle == (*allocations).p_slot_count) {
+        *error = BM0__et__allocation_failure__at_maximum;
+
+        // return 1 over the maximum indexable value
+        return (*allocations).p_slot_count;
+    }
+
+    // take slot
+    BM0__take_allocation_slot(allocations, handle);
+
+    // create allocation
+    if (policy != BM0__apt__default) {
+        (*allocations).p_buffers[handle] = BM0__create_buffer_with_policy(error, allocation_size, policy);
+        (*allocations).p_types[handle] = BM0__att__mapping;
+    } else if ((*allocations).p_arena != 0) {
+        (*allocations).p_buffers[handle].p_data = BM0__arena_allocate((*allocations).p_arena, allocation_size);
+        (*allocations).p_buffers[handle].p_length = allocation_size;
+        if ((*allocations).p_buffers[handle].p_data == 0) {
+            *error = BM0__et__allocation_failure__os_rejected_request;
+        }
+    } else {
+        (*allocations).p_buffers[handle] = BM0__create_buffer(error, allocation_size);
+    }
+
+    // give the slot back if the OS rejected the request
+    if ((*allocations).p_buffers[handle].p_data == 0) {
+        BM0__give_back_allocation_slot(allocations, handle);
+
+        // return 1 over the maximum indexable value
+        return (*allocations).p_slot_count;
+    }
+    (*allocations).p_live_count++;
+
+    return handle;
+}
+
+unsigned long long BM0__allocation_count(BM0__allocations* allocations) {
+    return (*allocations).p_live_count;
+}
+
+void BM0__deallocate_buffer_from_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long handle) {
+    // check if the buffer is in use
+    if (handle < (*allocations).p_slot_count && (*allocations).p_buffers[handle].p_data != 0) {
+        // destroy buffer
+        BM0__free_allocation(allocations, handle);
+
+        // give slot back
+        BM0__give_back_allocation_slot(allocations, handle);
+        (*allocations).p_live_count--;
+    // cannot deallocate non-existent buffer
+    } else {
+        *error = BM0__et__deallocation_failure;
+    }
+
+    return;
+}
+
+// maps a file, or anonymous memory when the file descriptor has all bits set, returns the one over maximum handle on failure
+unsigned long long BM0__map_to_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long file_descriptor, unsigned long long length, unsigned long long offset, unsigned long long protection, unsigned long long flags, void** address) {
+    unsigned long long handle = BM0__find_allocation_slot(allocations);
+
+    *address = MAP_FAILED;
+
+    // no empty buffers are found
+    if (handle == (*allocations).p_slot_count) {
+        *error = BM0__et__allocation_failure__at_maximum;
+
+        return (*allocations).p_slot_count;
+    }
+
+    // map
+    if (file_descriptor == ~0ull) {
+        flags |= MAP_ANONYMOUS;
+    }
+    *address = mmap(0, (size_t)length, (int)protection, (int)flags, (int)file_descriptor, (off_t)offset);
+    if (*address == MAP_FAILED) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return (*allocations).p_slot_count;
+    }
+
+    // take slot
+    BM0__take_allocation_slot(allocations, handle);
+    (*allocations).p_buffers[handle].p_data = *address;
+    (*allocations).p_buffers[handle].p_length = length;
+    (*allocations).p_types[handle] = BM0__att__mapping;
+    (*allocations).p_live_count++;
+
+    return handle;
+}
+
+// grows or shrinks a mapping in place or, with MREMAP_MAYMOVE, somewhere else, returns the new address or MAP_FAILED
+void* BM0__remap_allocation(BM0__et* error, BM0__allocations* allocations, unsigned long long handle, unsigned long long length, unsigned long long flags) {
+    void* address;
+
+    // only mappings can be remapped, the rest may live inside an arena
+    if (handle >= (*allocations).p_slot_count || (*allocations).p_buffers[handle].p_data == 0 || (*allocations).p_types[handle] != BM0__att__mapping) {
+        *error = BM0__et__deallocation_failure;
+
+        return MAP_FAILED;
+    }
+
+    // MREMAP_FIXED would take a new address from whatever the fifth argument holds and MREMAP_DONTUNMAP would leave an untracked mapping behind
+    if ((flags & ~(unsigned long long)MREMAP_MAYMOVE) != 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return MAP_FAILED;
+    }
+
+    address = (void*)syscall(__NR_mremap, (*allocations).p_buffers[handle].p_data, (size_t)(*allocations).p_buffers[handle].p_length, (size_t)length, (int)flags);
+    if (address == MAP_FAILED) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return MAP_FAILED;
+    }
+    (*allocations).p_buffers[handle].p_data = address;
+    (*allocations).p_buffers[handle].p_length = length;
+
+    return address;
+}
+
+// queues io requests, creating the io queue on first use, returns how many were queued
+unsigned long long BM0__submit_io_to_allocations(BM0__et* error, BM0__allocations* allocations, BM0__io_request* requests, unsigned long long count) {
+    if ((*allocations).p_io_queue == 0) {
+        (*allocations).p_io_queue = BM0__create_io_queue();
+        if ((*allocations).p_io_queue == 0) {
+            *error = BM0__et__io_queue_unavailable;
+
+            return 0;
+        }
+    }
+
+    return BM0__submit_io((*allocations).p_io_queue, requests, count);
+}
+
+// returns how many completions were written
+unsigned long long BM0__complete_io_from_allocations(BM0__allocations* allocations, BM0__io_completion* completions, unsigned long long maximum_count, unsigned long long minimum_count) {
+    if ((*allocations).p_io_queue == 0) {
+        return 0;
+    }
+
+    return BM0__complete_io((*allocations).p_io_queue, completions, maximum_count, minimum_count);
+}
+
+/* Channels */
+// one slot of a channel's ring, its sequence tells senders and receivers which position may use it next
+typedef struct BM0__channel_cell {
+    unsigned long long p_sequence;
+    BM0__buffer p_buffer;
+    unsigned long long p_type; // BM0__att, buffers in a channel are never part of an arena
+} BM0__channel_cell;
+
+// a bounded ring of buffers handed between byte machines without copying, lock free for any amount of senders and receivers
+typedef struct BM0__channel {
+    unsigned long long p_send_position;
+    unsigned long long p_send_padding[7]; // keeps senders and receivers on their own cache lines
+    unsigned long long p_receive_position;
+    unsigned long long p_receive_padding[7];
+    BM0__channel_cell* p_cells;
+    unsigned long long p_cell_count; // a power of two
+    BM0__boolean p_single_sender; // positions are claimed with plain stores instead of compare and swap
+    BM0__boolean p_single_receiver;
+} BM0__channel;
+
+// frees a buffer taken out of a channel that was not handed to a byte machine
+void BM0__destroy_channel_buffer(BM0__buffer buffer, BM0__att type) {
+    if (type == BM0__att__released_arena_allocation) {
+        BM0__deallocate_released_arena_allocation(buffer.p_data);
+    } else {
+        BM0__destroy_buffer(buffer);
+    }
+
+    return;
+}
+
+// the cell count is rounded up to a power of two of at least 2, a single sender or receiver may skip compare and swap on its side
+BM0__channel* BM0__create_channel(BM0__et* error, unsigned long long cell_count, BM0__boolean single_sender, BM0__boolean single_receiver) {
+    unsigned long long rounded_cell_count = 2;
+    BM0__channel* channel;
+
+    while (rounded_cell_count < cell_count) {
+        rounded_cell_count <<= 1;
+    }
+    channel = (BM0__channel*)BM0__allocate(sizeof(BM0__channel) + (sizeof(BM0__channel_cell) * rounded_cell_count));
+    if (channel == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    (*channel).p_send_position = 0;
+    (*channel).p_receive_position = 0;
+    (*channel).p_cells = (BM0__channel_cell*)(channel + 1);
+    (*channel).p_cell_count = rounded_cell_count;
+    (*channel).p_single_sender = single_sender;
+    (*channel).p_single_receiver = single_receiver;
+    for (unsigned long long i = 0; i < rounded_cell_count; i++) {
+        (*channel).p_cells[i].p_sequence = i;
+    }
+    *error = BM0__et__no_error;
+
+    return channel;
+}
+
+// adds a buffer unless the channel is full, the channel owns it once this returns true
+BM0__boolean BM0__push_to_channel(BM0__channel* channel, BM0__buffer buffer, BM0__att type) {
+    unsigned long long position = __atomic_load_n(&(*channel).p_send_position, __ATOMIC_RELAXED);
+    BM0__channel_cell* cell;
+    long long difference;
+
+    // claim a position whose cell was emptied by the receiver one lap ago
+    while (1) {
+        cell = &(*channel).p_cells[position & ((*channel).p_cell_count - 1)];
+        difference = (long long)(__atomic_load_n(&(*cell).p_sequence, __ATOMIC_ACQUIRE) - position);
+        if (difference == 0) {
+            if ((*channel).p_single_sender) {
+                __atomic_store_n(&(*channel).p_send_position, position + 1, __ATOMIC_RELAXED);
+
+                break;
+            }
+            if (__atomic_compare_exchange_n(&(*channel).p_send_position, &position, position + 1, BM0__boolean__true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return BM0__boolean__false;
+        } else {
+            position = __atomic_load_n(&(*channel).p_send_position, __ATOMIC_RELAXED);
+        }
+    }
+
+    // publish
+    (*cell).p_buffer = buffer;
+    (*cell).p_type = type;
+    __atomic_store_n(&(*cell).p_sequence, position + 1, __ATOMIC_RELEASE);
+
+    return BM0__boolean__true;
+}
+
+// takes the oldest buffer out unless the channel is empty, the caller owns it once this returns true
+BM0__boolean BM0__pop_from_channel(BM0__channel* channel, BM0__buffer* buffer, BM0__att* type) {
+    unsigned long long position = __atomic_load_n(&(*channel).p_receive_position, __ATOMIC_RELAXED);
+    BM0__channel_cell* cell;
+    long long difference;
+
+    // claim a position whose cell was filled by a sender
+    while (1) {
+        cell = &(*channel).p_cells[position & ((*channel).p_cell_count - 1)];
+        difference = (long long)(__atomic_load_n(&(*cell).p_sequence, __ATOMIC_ACQUIRE) - (position + 1));
+        if (difference == 0) {
+            if ((*channel).p_single_receiver) {
+                __atomic_store_n(&(*channel).p_receive_position, position + 1, __ATOMIC_RELAXED);
+
+                break;
+            }
+            if (__atomic_compare_exchange_n(&(*channel).p_receive_position, &position, position + 1, BM0__boolean__true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return BM0__boolean__false;
+        } else {
+            position = __atomic_load_n(&(*channel).p_receive_position, __ATOMIC_RELAXED);
+        }
+    }
+
+    // hand the cell back to senders for the next lap
+    *buffer = (*cell).p_buffer;
+    *type = (BM0__att)(*cell).p_type;
+    __atomic_store_n(&(*cell).p_sequence, position + (*channel).p_cell_count, __ATOMIC_RELEASE);
+
+    return BM0__boolean__true;
+}
+
+// sends a buffer made with BM0__create_buffer from the host, returns false when the channel is full
+BM0__boolean BM0__send_to_channel(BM0__channel* channel, BM0__buffer buffer) {
+    return BM0__push_to_channel(channel, buffer, BM0__att__mapping);
+}
+
+// receives a buffer on the host, it must be freed with BM0__destroy_channel_buffer, returns false when the channel is empty
+BM0__boolean BM0__receive_from_channel(BM0__channel* channel, BM0__buffer* buffer, BM0__att* type) {
+    return BM0__pop_from_channel(channel, buffer, type);
+}
+
+// frees every buffer still in the channel, nothing may be using the channel anymore
+void BM0__destroy_channel(BM0__channel* channel) {
+    BM0__buffer buffer;
+    BM0__att type;
+
+    while (BM0__pop_from_channel(channel, &buffer, &type)) {
+        BM0__destroy_channel_buffer(buffer, type);
+    }
+    BM0__deallocate(channel, sizeof(BM0__channel) + (sizeof(BM0__channel_cell) * (*channel).p_cell_count));
+
+    return;
+}
+
+// returns the channel attached under a number, or zero after setting the error
+BM0__channel* BM0__get_allocations_channel(BM0__et* error, BM0__allocations* allocations, unsigned long long channel_number) {
+    if (channel_number >= BM0__define__max_channel_count || (*allocations).p_channels[channel_number] == 0) {
+        *error = BM0__et__channel_unavailable;
+
+        return 0;
+    }
+
+    return (*allocations).p_channels[channel_number];
+}
+
+// moves an allocation into a channel and frees its handle, returns false and keeps the allocation when the channel is full
+// large arena allocations are released from the arena, small ones are copied into their own mapping since the arena stays with this machine
+BM0__boolean BM0__send_allocation_to_channel(BM0__et* error, BM0__allocations* allocations, unsigned long long channel_number, unsigned long long handle) {
+    BM0__channel* channel = BM0__get_allocations_channel(error, allocations, channel_number);
+    BM0__buffer buffer;
+    BM0__att type;
+
+    if (channel == 0) {
+        return BM0__boolean__false;
+    }
+    if (handle >= (*allocations).p_slot_count || (*allocations).p_buffers[handle].p_data == 0) {
+        *error = BM0__et__deallocation_failure;
+
+        return BM0__boolean__false;
+    }
+    buffer = (*allocations).p_buffers[handle];
+    type = (BM0__att)(*allocations).p_types[handle];
+
+    // take the buffer out of the arena, a released allocation keeps its address so the slot can keep it if the channel is full
+    if (type == BM0__att__buffer && (*allocations).p_arena != 0) {
+        if (BM0__get_arena_size_class(buffer.p_length) == BM0__define__arena_size_class_count) {
+            BM0__arena_release_large((*allocations).p_arena, buffer.p_data);
+            type = BM0__att__released_arena_allocation;
+            (*allocations).p_types[handle] = type;
+        } else {
+            buffer = BM0__create_buffer(error, buffer.p_length);
+            if (buffer.p_data == 0) {
+                return BM0__boolean__false;
+            }
+            BM0__copy_bytes((*allocations).p_buffers[handle].p_data, buffer.p_length, buffer.p_data);
+            type = BM0__att__mapping;
+        }
+    } else if (type == BM0__att__buffer) {
+        type = BM0__att__mapping;
+    }
+
+    // send
+    if (BM0__push_to_channel(channel, buffer, type) == BM0__boolean__false) {
+        if (buffer.p_data != (*allocations).p_buffers[handle].p_data) {
+            BM0__destroy_buffer(buffer);
+        }
+
+        return BM0__boolean__false;
+    }
+
+    // give the handle back, only a copied buffer's original is freed
+    if (buffer.p_data != (*allocations).p_buffers[handle].p_data) {
+        BM0__free_allocation(allocations, handle);
+    }
+    BM0__give_back_allocation_slot(allocations, handle);
+    (*allocations).p_live_count--;
+
+    return BM0__boolean__true;
+}
+
+// takes the oldest buffer out of a channel as a new allocation, returns the one over maximum handle when the channel is empty or every slot is in use
+unsigned long long BM0__receive_allocation_from_channel(BM0__et* error, BM0__allocations* allocations, unsigned long long channel_number) {
+    BM0__channel* channel = BM0__get_allocations_channel(error, allocations, channel_number);
+    unsigned long long handle = BM0__find_allocation_slot(allocations);
+    BM0__buffer buffer;
+    BM0__att type;
+
+    if (channel == 0) {
+        return (*allocations).p_slot_count;
+    }
+
+    // no empty buffers are found, the channel is left alone
+    if (handle == (*allocations).p_slot_count) {
+        *error = BM0__et__allocation_failure__at_maximum;
+
+        return (*allocations).p_slot_count;
+    }
+
+    // receive
+    if (BM0__pop_from_channel(channel, &buffer, &type) == BM0__boolean__false) {
+        return (*allocations).p_slot_count;
+    }
+    BM0__take_allocation_slot(allocations, handle);
+    (*allocations).p_buffers[handle] = buffer;
+    (*allocations).p_types[handle] = type;
+    (*allocations).p_live_count++;
+
+    return handle;
+}
+
+/* Hash Tables */
+// hash table operation type
+typedef enum BM0__hot {
+    BM0__hot__create, // the key register holds how many keys to make room for, writes the handle
+    BM0__hot__insert, // sets a key's value, writes 1 when the key is new
+    BM0__hot__lookup, // writes the key's value to the value register, and 1 when it was found
+    BM0__hot__add, // adds to a key's value, a new key starts at zero, writes the new value
+    BM0__hot__delete, // writes 1 when the key was removed
+    BM0__hot__iterate, // the destination register is a cursor, start it at zero, writes the next key and value and moves it on, zero once every key was seen
+    BM0__hot__count,
+    BM0__hot__clear
+} BM0__hot;
+
+// hash table control type, a used slot's control byte holds 7 bits of its key's hash instead
+typedef enum BM0__hct {
+    BM0__hct__empty = 0x80,
+    BM0__hct__deleted = 0xfe
+} BM0__hct;
+
+// one mapping without pointers: the header, a control byte per slot (the first group repeated after the last), keys and values
+// a group of control bytes is compared against 7 bits of the hash at once, so most lookups touch one key
+typedef struct BM0__hash_table {
+    unsigned long long p_capacity; // slots, a power of two
+    unsigned long long p_count;
+    unsigned long long p_deleted_count;
+    unsigned long long p_control_length; // rounded up so the keys stay aligned
+} BM0__hash_table;
+
+unsigned long long BM0__get_hash_table_length(unsigned long long capacity) {
+    return sizeof(BM0__hash_table) + ((capacity + BM0__define__hash_table_group_length + 7) & ~7ull) + (capacity * sizeof(unsigned long long) * 2);
+}
+
+unsigned char* BM0__get_hash_table_control(BM0__hash_table* table) {
+    return (unsigned char*)(table + 1);
+}
+
+unsigned long long* BM0__get_hash_table_keys(BM0__hash_table* table) {
+    return (unsigned long long*)(BM0__get_hash_table_control(table) + (*table).p_control_length);
+}
+
+unsigned long long* BM0__get_hash_table_values(BM0__hash_table* table) {
+    return BM0__get_hash_table_keys(table) + (*table).p_capacity;
+}
+
+#ifdef BM0__enable__simd
+__attribute__((target("sse4.2"))) unsigned long long BM0__hash_key__crc32c(unsigned long long key) {
+    // spread the 32 bit checksum over 64 bits so every capacity gets well mixed slot bits
+    return _mm_crc32_u64(0, key) * 0x9e3779b97f4a7c15ull;
+}
+#endif
+
+// CRC32C when the host has it, detected on first use, and a multiply and shift mix otherwise
+unsigned long long BM0__hash_key(unsigned long long key) {
+#ifdef BM0__enable__simd
+    static int has_crc32c = -1;
+
+    if (has_crc32c < 0) {
+        __builtin_cpu_init();
+        has_crc32c = __builtin_cpu_supports("sse4.2") ? 1 : 0;
+    }
+    if (has_crc32c) {
+        return BM0__hash_key__crc32c(key);
+    }
+#endif
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ull;
+    key ^= key >> 33;
+
+    return key;
+}
+
+// returns a bit per control byte of the group starting at the slot that equals the byte
+unsigned int BM0__match_hash_table_group(unsigned char* control, unsigned char byte) {
+#ifdef BM0__enable__simd
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)control), _mm_set1_epi8((char)byte)));
+#else
+    unsigned int output = 0;
+
+    for (unsigned long long i = 0; i < BM0__define__hash_table_group_length; i++) {
+        output |= (unsigned int)(control[i] == byte) << i;
+    }
+
+    return output;
+#endif
+}
+
+// returns a bit per used slot of the group starting at the slot
+unsigned int BM0__match_hash_table_group_used(unsigned char* control) {
+#ifdef BM0__enable__simd
+    return ~(unsigned int)_mm_movemask_epi8(_mm_loadu_si128((__m128i*)control)) & 0xffff;
+#else
+    unsigned int output = 0;
+
+    for (unsigned long long i = 0; i < BM0__define__hash_table_group_length; i++) {
+        output |= (unsigned int)(control[i] < BM0__hct__empty) << i;
+    }
+
+    return output;
+#endif
+}
+
+void BM0__set_hash_table_control(BM0__hash_table* table, unsigned long long slot, unsigned char byte) {
+    BM0__get_hash_table_control(table)[slot] = byte;
+    if (slot < BM0__define__hash_table_group_length) {
+        BM0__get_hash_table_control(table)[(*table).p_capacity + slot] = byte;
+    }
+
+    return;
+}
+
+void BM0__clear_hash_table(BM0__hash_table* table) {
+    BM0__fill_bytes(BM0__get_hash_table_control(table), (*table).p_capacity + BM0__define__hash_table_group_length, BM0__hct__empty);
+    (*table).p_count = 0;
+    (*table).p_deleted_count = 0;
+
+    return;
+}
+
+// the capacity is rounded up to a power of two, returns zero on failure
+BM0__hash_table* BM0__create_hash_table(unsigned long long capacity) {
+    BM0__hash_table* table;
+
+    if (capacity > (1ull << BM0__define__hash_table_maximum_capacity_bits)) {
+        return 0;
+    }
+    capacity = capacity < BM0__define__hash_table_minimum_capacity ? BM0__define__hash_table_minimum_capacity : capacity;
+    capacity = 1ull << (64 - __builtin_clzll(capacity - 1));
+    table = (BM0__hash_table*)BM0__allocate(BM0__get_hash_table_length(capacity));
+    if (table == 0) {
+        return 0;
+    }
+    (*table).p_capacity = capacity;
+    (*table).p_control_length = (capacity + BM0__define__hash_table_group_length + 7) & ~7ull;
+    BM0__clear_hash_table(table);
+
+    return table;
+}
+
+// returns the key's slot or the capacity when it is not in the table
+unsigned long long BM0__find_hash_table_key(BM0__hash_table* table, unsigned long long key, unsigned long long hash) {
+    unsigned char* control = BM0__get_hash_table_control(table);
+    unsigned long long* keys = BM0__get_hash_table_keys(table);
+    unsigned long long mask = (*table).p_capacity - 1;
+    unsigned long long slot = (hash >> 7) & mask;
+    unsigned int matches;
+
+    // groups are probed with growing steps, which visits every group of a power of two table
+    for (unsigned long long step = BM0__define__hash_table_group_length; ; step += BM0__define__hash_table_group_length) {
+        matches = BM0__match_hash_table_group(control + slot, (unsigned char)(hash & 0x7f));
+        while (matches != 0) {
+            if (keys[(slot + __builtin_ctz(matches)) & mask] == key) {
+                return (slot + __builtin_ctz(matches)) & mask;
+            }
+            matches &= matches - 1;
+        }
+        if (BM0__match_hash_table_group(control + slot, BM0__hct__empty) != 0) {
+            return (*table).p_capacity;
+        }
+        slot = (slot + step) & mask;
+    }
+}
+
+// returns the first empty or deleted slot a key with the hash can go in, the table always has one
+unsigned long long BM0__find_hash_table_free_slot(BM0__hash_table* table, unsigned long long hash) {
+    unsigned char* control = BM0__get_hash_table_control(table);
+    unsigned long long mask = (*table).p_capacity - 1;
+    unsigned long long slot = (hash >> 7) & mask;
+    unsigned int matches;
+
+    for (unsigned long long step = BM0__define__hash_table_group_length; ; step += BM0__define__hash_table_group_length) {
+        matches = ~BM0__match_hash_table_group_used(control + slot) & 0xffff;
+        if (matches != 0) {
+            return (slot + __builtin_ctz(matches)) & mask;
+        }
+        slot = (slot + step) & mask;
+    }
+}
+
+// puts a key that is not in the table into a free slot
+void BM0__place_hash_table_key(BM0__hash_table* table, unsigned long long key, unsigned long long value, unsigned long long hash) {
+    unsigned long long slot = BM0__find_hash_table_free_slot(table, hash);
+
+    if (BM0__get_hash_table_control(table)[slot] == BM0__hct__deleted) {
+        (*table).p_deleted_count--;
+    }
+    BM0__set_hash_table_control(table, slot, (unsigned char)(hash & 0x7f));
+    BM0__get_hash_table_keys(table)[slot] = key;
+    BM0__get_hash_table_values(table)[slot] = value;
+    (*table).p_count++;
+
+    return;
+}
+
+// moves every key into a new table, doubling it when it is getting full and only dropping deleted slots otherwise
+BM0__hash_table* BM0__grow_hash_table(BM0__allocations* allocations, unsigned long long handle) {
+    BM0__hash_table* table = (BM0__hash_table*)(*allocations).p_buffers[handle].p_data;
+    BM0__hash_table* grown;
+    unsigned char* control = BM0__get_hash_table_control(table);
+
+    grown = BM0__create_hash_table(((*table).p_count + 1) * 16 > (*table).p_capacity * 7 ? (*table).p_capacity * 2 : (*table).p_capacity);
+    if (grown == 0) {
+        return 0;
+    }
+    for (unsigned long long i = 0; i < (*table).p_capacity; i++) {
+        if (control[i] < BM0__hct__empty) {
+            BM0__place_hash_table_key(grown, BM0__get_hash_table_keys(table)[i], BM0__get_hash_table_values(table)[i], BM0__hash_key(BM0__get_hash_table_keys(table)[i]));
+        }
+    }
+    BM0__deallocate(table, (*allocations).p_buffers[handle].p_length);
+    (*allocations).p_buffers[handle].p_data = grown;
+    (*allocations).p_buffers[handle].p_length = BM0__get_hash_table_length((*grown).p_capacity);
+
+    return grown;
+}
+
+// makes a hash table as an allocation, returns the one over maximum handle on failure
+unsigned long long BM0__create_hash_table_in_allocations(BM0__et* error, BM0__allocations* allocations, unsigned long long capacity) {
+    unsigned long long handle = BM0__find_allocation_slot(allocations);
+    BM0__hash_table* table;
+
+    // no empty buffers are found
+    if (handle == (*allocations).p_slot_count) {
+        *error = BM0__et__allocation_failure__at_maximum;
+
+        return (*allocations).p_slot_count;
+    }
+
+    // room for the keys at most seven eighths full, counts no table could hold are rejected before they can wrap
+    table = capacity <= (1ull << BM0__define__hash_table_maximum_capacity_bits) ? BM0__create_hash_table(capacity + (capacity / 7) + 1) : 0;
+    if (table == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return (*allocations).p_slot_count;
+    }
+
+    // take slot
+    BM0__take_allocation_slot(allocations, handle);
+    (*allocations).p_buffers[handle].p_data = table;
+    (*allocations).p_buffers[handle].p_length = BM0__get_hash_table_length((*table).p_capacity);
+    (*allocations).p_types[handle] = BM0__att__hash_table;
+    (*allocations).p_live_count++;
+
+    return handle;
+}
+
+// performs a hash table operation, returns false for an unknown operation
+// errors leave the destination register zeroed
+BM0__boolean BM0__perform_hash_table_operation(BM0__et* error, void** regs, BM0__allocations* allocations, unsigned char operation, unsigned char table_register, unsigned char key_register, unsigned char value_register, unsigned char destination_register) {
+    unsigned long long handle = (unsigned long long)regs[table_register];
+    unsigned long long key = (unsigned long long)regs[key_register];
+    unsigned long long value = (unsigned long long)regs[value_register];
+    BM0__hash_table* table = 0;
+    unsigned long long hash;
+    unsigned long long slot;
+    unsigned int matches;
+
+    if (operation > BM0__hot__clear) {
+        return BM0__boolean__false;
+    }
+    BM0__lock_allocations(allocations);
+    if (operation == BM0__hot__create) {
+        regs[destination_register] = (void*)BM0__create_hash_table_in_allocations(error, allocations, key);
+        BM0__unlock_allocations(allocations);
+
+        return BM0__boolean__true;
+    }
+
+    // find table
+    if (handle < (*allocations).p_slot_count && (*allocations).p_buffers[handle].p_data != 0 && (*allocations).p_types[handle] == BM0__att__hash_table) {
+        table = (BM0__hash_table*)(*allocations).p_buffers[handle].p_data;
+    }
+    if (table == 0) {
+        *error = BM0__et__invalid_hash_table;
+        regs[destination_register] = 0;
+        BM0__unlock_allocations(allocations);
+
+        return BM0__boolean__true;
+    }
+
+    hash = BM0__hash_key(key);
+    switch ((BM0__hot)operation) {
+    case BM0__hot__insert:
+    case BM0__hot__add:
+        slot = BM0__find_hash_table_key(table, key, hash);
+        if (slot != (*table).p_capacity) {
+            BM0__get_hash_table_values(table)[slot] = operation == BM0__hot__add ? BM0__get_hash_table_values(table)[slot] + value : value;
+            regs[destination_register] = operation == BM0__hot__add ? (void*)BM0__get_hash_table_values(table)[slot] : 0;
+
+            break;
+        }
+
+        // keep at least one eighth of the slots empty so probing stays short
+        if (((*table).p_count + (*table).p_deleted_count + 1) * 8 > (*table).p_capacity * 7) {
+            table = BM0__grow_hash_table(allocations, handle);
+            if (table == 0) {
+                *error = BM0__et__allocation_failure__os_rejected_request;
+                regs[destination_register] = 0;
+
+                break;
+            }
+        }
+        BM0__place_hash_table_key(table, key, value, hash);
+        regs[destination_register] = operation == BM0__hot__add ? (void*)value : (void*)1;
+
+        break;
+    case BM0__hot__lookup:
+        slot = BM0__find_hash_table_key(table, key, hash);
+        regs[value_register] = slot != (*table).p_capacity ? (void*)BM0__get_hash_table_values(table)[slot] : 0;
+        regs[destination_register] = (void*)(unsigned long long)(slot != (*table).p_capacity);
+
+        break;
+    case BM0__hot__delete:
+        slot = BM0__find_hash_table_key(table, key, hash);
+        if (slot != (*table).p_capacity) {
+            BM0__set_hash_table_control(table, slot, BM0__hct__deleted);
+            (*table).p_count--;
+            (*table).p_deleted_count++;
+        }
+        regs[destination_register] = (void*)(unsigned long long)(slot != (*table).p_capacity);
+
+        break;
+    case BM0__hot__iterate:
+        // the cursor is one past the last slot handed out, whole groups of empty slots are skipped at once
+        slot = (unsigned long long)regs[destination_register];
+        regs[destination_register] = 0;
+        while (slot < (*table).p_capacity) {
+            matches = BM0__match_hash_table_group_used(BM0__get_hash_table_control(table) + slot);
+            if ((*table).p_capacity - slot < BM0__define__hash_table_group_length) {
+                matches &= (1u << ((*table).p_capacity - slot)) - 1;
+            }
+            if (matches != 0) {
+                slot += __builtin_ctz(matches);
+                regs[key_register] = (void*)BM0__get_hash_table_keys(table)[slot];
+                regs[value_register] = (void*)BM0__get_hash_table_values(table)[slot];
+                regs[destination_register] = (void*)(slot + 1);
+
+                break;
+            }
+            slot += BM0__define__hash_table_group_length;
+        }
+
+        break;
+    case BM0__hot__count:
+        regs[destination_register] = (void*)(*table).p_count;
+
+        break;
+    case BM0__hot__clear:
+        BM0__clear_hash_table(table);
+        regs[destination_register] = 0;
+
+        break;
+    default:
+        break;
+    }
+    BM0__unlock_allocations(allocations);
+
+    return BM0__boolean__true;
+}
+
+/* Byte Machine */
+// instruction length type
+typedef enum BM0__ilt {
+    BM0__ilt__quit = 4,
+    BM0__ilt__write_register = 11,
+    BM0__ilt__allocate = 6,
+    BM0__ilt__deallocate = 3,
+    BM0__ilt__buffer_to_register = 5,
+    BM0__ilt__register_to_register = 4,
+    BM0__ilt__register_to_buffer = 5,
+    BM0__ilt__operate = 8,
+    BM0__ilt__do_x86_64_linux_syscall_limited = 10,
+    BM0__ilt__buffer_to_buffer = 5,
+    BM0__ilt__fill_buffer = 5,
+    BM0__ilt__compare_buffers = 6,
+    BM0__ilt__buffer_to_vector = 4,
+    BM0__ilt__vector_to_buffer = 4,
+    BM0__ilt__register_to_vector = 5,
+    BM0__ilt__vector_operate = 9,
+    BM0__ilt__reduce_vector = 6,
+    BM0__ilt__submit_io = 5,
+    BM0__ilt__complete_io = 6,
+    BM0__ilt__send_to_channel = 5,
+    BM0__ilt__receive_from_channel = 6,
+    BM0__ilt__spawn = 4,
+    BM0__ilt__join = 4,
+    BM0__ilt__atomic_operate = 7,
+    BM0__ilt__allocate_with_policy = 7,
+    BM0__ilt__hash_table_operate = 7
+} BM0__ilt;
+
+// register type
+typedef enum BM0__rt {
+    BM0__rt__instruction_pointer_register = 0,
+    BM0__rt__instruction_ID_register = 1,
+    BM0__rt__instruction_parameter_register_0 = 2,
+    BM0__rt__instruction_parameter_register_1 = 3,
+    BM0__rt__instruction_parameter_register_2 = 4,
+    BM0__rt__instruction_parameter_register_3 = 5,
+    BM0__rt__instruction_parameter_register_4 = 6,
+    BM0__rt__instruction_parameter_register_5 = 7,
+    BM0__rt__instruction_parameter_register_6 = 8,
+    BM0__rt__instruction_parameter_register_7 = 9,
+    BM0__rt__input_buffers_length_register = 10,
+    BM0__rt__input_buffers_pointer_register = 11,
+    BM0__rt__instruction_error_code_register_register = 12,
+    BM0__rt__REGISTER_COUNT = 13
+} BM0__rt;
+
+// instruction type
+typedef enum BM0__it {
+    BM0__it__quit,
+    BM0__it__write_register,
+    BM0__it__allocate,
+    BM0__it__deallocate,
+    BM0__it__buffer_to_register,
+    BM0__it__register_to_register,
+    BM0__it__register_to_buffer,
+    BM0__it__operate,
+    BM0__it__do_x86_64_linux_syscall_limited,
+    BM0__it__buffer_to_buffer,
+    BM0__it__fill_buffer,
+    BM0__it__compare_buffers,
+    BM0__it__buffer_to_vector,
+    BM0__it__vector_to_buffer,
+    BM0__it__register_to_vector,
+    BM0__it__vector_operate,
+    BM0__it__reduce_vector,
+    BM0__it__submit_io,
+    BM0__it__complete_io,
+    BM0__it__send_to_channel,
+    BM0__it__receive_from_channel,
+    BM0__it__spawn,
+    BM0__it__join,
+    BM0__it__atomic_operate,
+    BM0__it__allocate_with_policy,
+    BM0__it__hash_table_operate
+} BM0__it;
+
+// operation type
+typedef enum BM0__ot {
+    // binary
+    BM0__ot__binary__right_shift,
+    BM0__ot__binary__left_shift,
+    BM0__ot__binary__not,
+    BM0__ot__binary__and,
+    BM0__ot__binary__or,
+    BM0__ot__binary__xor,
+
+    // integer
+    BM0__ot__integer__add,
+    BM0__ot__integer__subtract,
+    BM0__ot__integer__multiply,
+    BM0__ot__integer__divide,
+    BM0__ot__integer__modulous,
+
+    // Comparison
+    BM0__ot__comparison__less_than,
+    BM0__ot__comparison__equal_to,
+    BM0__ot__comparison__not_equal_to,
+    BM0__ot__comparison__greater_than
+} BM0__ot;
+
+// syscall type
+typedef enum BM0__st {
+    BM0__st__read,
+    BM0__st__write,
+    BM0__st__open,
+    BM0__st__close,
+    BM0__st__stat,
+    BM0__st__fstat,
+    BM0__st__mmap,
+    BM0__st__munmap,
+    BM0__st__madvise,
+    BM0__st__mremap,
+    BM0__st__readv,
+    BM0__st__writev,
+    BM0__st__pread,
+    BM0__st__pwrite,
+    BM0__st__sendfile,
+    BM0__st__copy_file_range,
+    BM0__st__futex_wait,
+    BM0__st__futex_wake
+} BM0__st;
+
+// atomic operation type, every atomic operation is sequentially consistent so it is also an acquire and release fence
+typedef enum BM0__aot {
+    BM0__aot__load,
+    BM0__aot__exchange,
+    BM0__aot__compare_exchange, // stores the value only if the old value equals the expected value
+    BM0__aot__fetch_add,
+    BM0__aot__fetch_subtract,
+    BM0__aot__fetch_and,
+    BM0__aot__fetch_or,
+    BM0__aot__fetch_xor,
+    BM0__aot__fence // touches no memory
+} BM0__aot;
+
+// operate mode type
+typedef enum BM0__omt {
+    BM0__omt__flag_bit__direct_operation,
+    BM0__omt__flag_bit__register_operation,
+    BM0__omt__always__direct_operation,
+    BM0__omt__always__register_operation
+} BM0__omt;
+
+BM0__omt BM0__get_operate_mode(unsigned char required_flag_bit) {
+    if (required_flag_bit < (unsigned char)32) {
+        return BM0__omt__flag_bit__direct_operation;
+    } else if (required_flag_bit < (unsigned char)64) {
+        return BM0__omt__flag_bit__register_operation;
+    } else if (required_flag_bit < (unsigned char)128) {
+        return BM0__omt__always__direct_operation;
+    } else {
+        return BM0__omt__always__register_operation;
+    }
+}
+
+unsigned long long BM0__get_operate_flag_mask(unsigned char required_flag_bit) {
+    // the flag bit is shifted as a 32-bit integer, so only the bottom 5 bits are used and bit 31 is sign extended
+    return (unsigned long long)(long long)(int)(1u << (required_flag_bit & 31));
+}
+
+BM0__boolean BM0__perform_operation(void** regs, unsigned short operation, unsigned char source_register_1, unsigned char source_register_2, unsigned char destination_register) {
+    switch ((BM0__ot)operation) {
+    case BM0__ot__binary__right_shift:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] >> (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__binary__left_shift:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] << (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__binary__not:
+        regs[destination_register] = (void*)(~(unsigned long long)regs[source_register_1]);
+        break;
+    case BM0__ot__binary__and:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] & (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__binary__or:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] | (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__binary__xor:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] ^ (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__integer__add:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] + (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__integer__subtract:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] - (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__integer__multiply:
+        regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] * (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__integer__divide:
+        if ((unsigned long long)regs[source_register_2] != 0) {
+            regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] / (unsigned long long)regs[source_register_2]);
+        } else {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__division_by_zero_attempted;
+        }
+
+        break;
+    case BM0__ot__integer__modulous:
+        if ((unsigned long long)regs[source_register_2] != 0) {
+            regs[destination_register] = (void*)((unsigned long long)regs[source_register_1] % (unsigned long long)regs[source_register_2]);
+        } else {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__modulus_by_zero_attempted;
+        }
+
+        break;
+    case BM0__ot__comparison__less_than:
+        regs[destination_register] = (void*)(unsigned long long)((unsigned long long)regs[source_register_1] < (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__comparison__equal_to:
+        regs[destination_register] = (void*)(unsigned long long)((unsigned long long)regs[source_register_1] == (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__comparison__not_equal_to:
+        regs[destination_register] = (void*)(unsigned long long)((unsigned long long)regs[source_register_1] != (unsigned long long)regs[source_register_2]);
+        break;
+    case BM0__ot__comparison__greater_than:
+        regs[destination_register] = (void*)(unsigned long long)((unsigned long long)regs[source_register_1] > (unsigned long long)regs[source_register_2]);
+        break;
+    // in case there is an invalid / unimplemented operation ID
+    default:
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+// vector operation type
+typedef enum BM0__vot {
+    // binary
+    BM0__vot__binary__right_shift, // lane-wise, shift amounts wrap at the lane width
+    BM0__vot__binary__left_shift,
+    BM0__vot__binary__not,
+    BM0__vot__binary__and,
+    BM0__vot__binary__or,
+    BM0__vot__binary__xor,
+
+    // integer
+    BM0__vot__integer__add,
+    BM0__vot__integer__subtract,
+    BM0__vot__integer__minimum,
+    BM0__vot__integer__maximum,
+
+    // comparison, lanes become all ones when true and zero when false
+    BM0__vot__comparison__less_than,
+    BM0__vot__comparison__equal_to,
+    BM0__vot__comparison__not_equal_to,
+    BM0__vot__comparison__greater_than
+} BM0__vot;
+
+// vector lane type, all lanes are unsigned
+typedef enum BM0__vlt {
+    BM0__vlt__8_bit,
+    BM0__vlt__16_bit,
+    BM0__vlt__32_bit,
+    BM0__vlt__64_bit
+} BM0__vlt;
+
+// vector reduction type
+typedef enum BM0__vrt {
+    BM0__vrt__add, // wraps at 64 bits
+    BM0__vrt__minimum,
+    BM0__vrt__maximum,
+    BM0__vrt__or,
+    BM0__vrt__mask, // bit N is set when lane N is not zero
+    BM0__vrt__first_nonzero // index of the first lane that is not zero, or the lane count
+} BM0__vrt;
+
+// one vector register viewed as each lane type
+typedef unsigned char BM0__vector __attribute__((vector_size(BM0__define__vector_register_length), aligned(BM0__define__vector_register_length)));
+typedef unsigned char BM0__vector__8_bit __attribute__((vector_size(BM0__define__vector_register_length), may_alias));
+typedef unsigned short BM0__vector__16_bit __attribute__((vector_size(BM0__define__vector_register_length), may_alias));
+typedef unsigned int BM0__vector__32_bit __attribute__((vector_size(BM0__define__vector_register_length), may_alias));
+typedef unsigned long long BM0__vector__64_bit __attribute__((vector_size(BM0__define__vector_register_length), may_alias));
+
+// vector code is built for AVX2 and a baseline, the loader picks one
+#ifdef BM0__enable__simd
+#define BM0__vector_clones __attribute__((target_clones("avx2", "default")))
+#else
+#define BM0__vector_clones
+#endif
+
+// one operation over every lane of a lane type, the comparison masks share the lane width so casting them keeps their bits
+#define BM0__vector_operation__lanes(type, lane_bits) { \
+    type a = *(type*)&vectors[source_vector_register_1]; \
+    type b = *(type*)&vectors[source_vector_register_2]; \
+    type* result = (type*)&vectors[destination_vector_register]; \
+    switch ((BM0__vot)operation) { \
+    case BM0__vot__binary__right_shift: \
+        *result = a >> (b & (lane_bits - 1)); \
+        break; \
+    case BM0__vot__binary__left_shift: \
+        *result = a << (b & (lane_bits - 1)); \
+        break; \
+    case BM0__vot__binary__not: \
+        *result = ~a; \
+        break; \
+    case BM0__vot__binary__and: \
+        *result = a & b; \
+        break; \
+    case BM0__vot__binary__or: \
+        *result = a | b; \
+        break; \
+    case BM0__vot__binary__xor: \
+        *result = a ^ b; \
+        break; \
+    case BM0__vot__integer__add: \
+        *result = a + b; \
+        break; \
+    case BM0__vot__integer__subtract: \
+        *result = a - b; \
+        break; \
+    case BM0__vot__integer__minimum: \
+        *result = (a & (type)(a < b)) | (b & ~(type)(a < b)); \
+        break; \
+    case BM0__vot__integer__maximum: \
+        *result = (a & (type)(a > b)) | (b & ~(type)(a > b)); \
+        break; \
+    case BM0__vot__comparison__less_than: \
+        *result = (type)(a < b); \
+        break; \
+    case BM0__vot__comparison__equal_to: \
+        *result = (type)(a == b); \
+        break; \
+    case BM0__vot__comparison__not_equal_to: \
+        *result = (type)(a != b); \
+        break; \
+    case BM0__vot__comparison__greater_than: \
+        *result = (type)(a > b); \
+        break; \
+    default: \
+        return BM0__boolean__false; \
+    } \
+}
+
+// returns false for an invalid operation or lane type
+BM0__vector_clones BM0__boolean BM0__perform_vector_operation(BM0__vector* vectors, unsigned short operation, unsigned char lane_type, unsigned char source_vector_register_1, unsigned char source_vector_register_2, unsigned char destination_vector_register) {
+    switch ((BM0__vlt)lane_type) {
+    case BM0__vlt__8_bit:
+        BM0__vector_operation__lanes(BM0__vector__8_bit, 8)
+        break;
+    case BM0__vlt__16_bit:
+        BM0__vector_operation__lanes(BM0__vector__16_bit, 16)
+        break;
+    case BM0__vlt__32_bit:
+        BM0__vector_operation__lanes(BM0__vector__32_bit, 32)
+        break;
+    case BM0__vlt__64_bit:
+        BM0__vector_operation__lanes(BM0__vector__64_bit, 64)
+        break;
+    default:
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+#undef BM0__vector_operation__lanes
+
+// copies the bottom lane of a register into every lane, returns false for an invalid lane type
+BM0__boolean BM0__broadcast_to_vector(BM0__vector* vectors, unsigned char lane_type, unsigned long long value, unsigned char destination_vector_register) {
+    switch ((BM0__vlt)lane_type) {
+    case BM0__vlt__8_bit:
+        *(BM0__vector__8_bit*)&vectors[destination_vector_register] = (BM0__vector__8_bit){} + (unsigned char)value;
+        break;
+    case BM0__vlt__16_bit:
+        *(BM0__vector__16_bit*)&vectors[destination_vector_register] = (BM0__vector__16_bit){} + (unsigned short)value;
+        break;
+    case BM0__vlt__32_bit:
+        *(BM0__vector__32_bit*)&vectors[destination_vector_register] = (BM0__vector__32_bit){} + (unsigned int)value;
+        break;
+    case BM0__vlt__64_bit:
+        *(BM0__vector__64_bit*)&vectors[destination_vector_register] = (BM0__vector__64_bit){} + value;
+        break;
+    default:
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+unsigned long long BM0__get_vector_lane(BM0__vector* vector, BM0__vlt lane_type, unsigned long long lane) {
+    switch (lane_type) {
+    case BM0__vlt__8_bit:
+        return (*(BM0__vector__8_bit*)vector)[lane];
+    case BM0__vlt__16_bit:
+        return (*(BM0__vector__16_bit*)vector)[lane];
+    case BM0__vlt__32_bit:
+        return (*(BM0__vector__32_bit*)vector)[lane];
+    default:
+        return (*(BM0__vector__64_bit*)vector)[lane];
+    }
+}
+
+// folds every lane of a vector into a register, returns false for an invalid reduction or lane type
+BM0__vector_clones BM0__boolean BM0__perform_vector_reduction(void** regs, BM0__vector* vectors, unsigned char reduction, unsigned char lane_type, unsigned char source_vector_register, unsigned char destination_register) {
+    unsigned long long lane_count;
+    unsigned long long lane;
+    unsigned long long output;
+
+    if (lane_type > BM0__vlt__64_bit || reduction > BM0__vrt__first_nonzero) {
+        return BM0__boolean__false;
+    }
+    lane_count = BM0__define__vector_register_length >> lane_type;
+
+    // setup starting value
+    output = 0;
+    if (reduction == BM0__vrt__minimum) {
+        output = ~0ull;
+    } else if (reduction == BM0__vrt__first_nonzero) {
+        output = lane_count;
+    }
+
+    // fold lanes, going backwards so the first nonzero lane is written last
+    for (unsigned long long i = lane_count; i > 0; i--) {
+        lane = BM0__get_vector_lane(&vectors[source_vector_register], (BM0__vlt)lane_type, i - 1);
+
+        switch ((BM0__vrt)reduction) {
+        case BM0__vrt__add:
+            output += lane;
+            break;
+        case BM0__vrt__minimum:
+            output = lane < output ? lane : output;
+            break;
+        case BM0__vrt__maximum:
+            output = lane > output ? lane : output;
+            break;
+        case BM0__vrt__or:
+            output |= lane;
+            break;
+        case BM0__vrt__mask:
+            output |= (unsigned long long)(lane != 0) << (i - 1);
+            break;
+        case BM0__vrt__first_nonzero:
+            output = lane != 0 ? i - 1 : output;
+            break;
+        }
+    }
+    regs[destination_register] = (void*)output;
+
+    return BM0__boolean__true;
+}
+
+// turns byte machine buffers into iovecs, returns false if there are too many
+BM0__boolean BM0__create_io_vectors(BM0__buffer* buffers, unsigned long long count, struct iovec* io_vectors) {
+    if (count > BM0__define__max_io_vector_count) {
+        return BM0__boolean__false;
+    }
+
+    for (unsigned long long i = 0; i < count; i++) {
+        io_vectors[i].iov_base = buffers[i].p_data;
+        io_vectors[i].iov_len = (size_t)buffers[i].p_length;
+    }
+
+    return BM0__boolean__true;
+}
+
+// points at an offset register's value, or returns 0 to use the file position when all of its bits are set
+off_t* BM0__get_syscall_offset(void** regs, unsigned char offset_register, off_t* offset) {
+    if ((unsigned long long)regs[offset_register] == ~0ull) {
+        return 0;
+    }
+    *offset = (off_t)(unsigned long long)regs[offset_register];
+
+    return offset;
+}
+
+// finds the memory a syscall will write to, returns false if it only writes registers
+BM0__boolean BM0__get_syscall_write_range(void** regs, unsigned char syscall_number, unsigned char argument_1, unsigned char argument_2, unsigned char argument_3, void** address, unsigned long long* length) {
+    BM0__buffer* buffers;
+
+    (void)argument_1;
+    switch ((BM0__st)syscall_number) {
+    case BM0__st__read:
+    case BM0__st__pread:
+        *address = regs[argument_2];
+        *length = (unsigned long long)regs[argument_3];
+
+        return BM0__boolean__true;
+    case BM0__st__readv:
+        // covers every buffer at once
+        buffers = (BM0__buffer*)regs[argument_2];
+        if ((unsigned long long)regs[argument_3] == 0 || (unsigned long long)regs[argument_3] > BM0__define__max_io_vector_count) {
+            return BM0__boolean__false;
+        }
+        *address = buffers[0].p_data;
+        *length = 0;
+        for (unsigned long long i = 0; i < (unsigned long long)regs[argument_3]; i++) {
+            if (buffers[i].p_data < *address) {
+                *length += (unsigned long long)(*address - buffers[i].p_data);
+                *address = buffers[i].p_data;
+            }
+            if (buffers[i].p_data + buffers[i].p_length > *address + *length) {
+                *length = (unsigned long long)(buffers[i].p_data + buffers[i].p_length - *address);
+            }
+        }
+
+        return BM0__boolean__true;
+    default:
+        return BM0__boolean__false;
+    }
+}
+
+BM0__boolean BM0__perform_syscall(void** regs, BM0__allocations* allocations, unsigned char syscall_number, unsigned char argument_1, unsigned char argument_2, unsigned char argument_3, unsigned char argument_4, unsigned char argument_5, unsigned char argument_6, unsigned char return_value_destination_register) {
+    struct stat stat_temporary;
+    BM0__et* error = (BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]];
+    void* address;
+    struct iovec io_vectors[BM0__define__max_io_vector_count];
+    off_t offset_1;
+    off_t offset_2;
+    off_t* offset_pointer_1;
+    off_t* offset_pointer_2;
+    struct timespec timeout;
+
+    switch ((BM0__st)syscall_number) {
+    case BM0__st__read:
+        regs[return_value_destination_register] = (void*)(unsigned long long)read((unsigned int)(unsigned long long)regs[argument_1], regs[argument_2], (size_t)(unsigned long long)regs[argument_3]);
+
+        break;
+    case BM0__st__write:
+        regs[return_value_destination_register] = (void*)(unsigned long long)write((unsigned int)(unsigned long long)regs[argument_1], regs[argument_2], (size_t)(unsigned long long)regs[argument_3]);
+
+        break;
+    case BM0__st__open:
+        regs[return_value_destination_register] = (void*)(unsigned long long)open((const char*)regs[argument_1], (int)(unsigned long long)regs[argument_2]);
+
+        break;
+    case BM0__st__close:
+        regs[return_value_destination_register] = (void*)(unsigned long long)close((int)(unsigned long long)regs[argument_1]);
+
+        break;
+    case BM0__st__stat:
+        regs[BM0__rt__instruction_parameter_register_7] = (void*)(unsigned long long)stat((const char*)regs[argument_1], &stat_temporary);
+
+        regs[argument_2] = (void*)(unsigned long long)stat_temporary.st_size;
+        regs[argument_3] = (void*)(unsigned long long)stat_temporary.st_mode;
+
+        break;
+    case BM0__st__fstat:
+        regs[BM0__rt__instruction_parameter_register_7] = (void*)(unsigned long long)fstat((int)(unsigned long long)regs[argument_1], &stat_temporary);
+
+        regs[argument_2] = (void*)(unsigned long long)stat_temporary.st_size;
+        regs[argument_3] = (void*)(unsigned long long)stat_temporary.st_mode;
+
+        break;
+    case BM0__st__mmap:
+        // the mapping is tracked like an allocation, its handle goes to the sixth argument
+        BM0__lock_allocations(allocations);
+        regs[argument_6] = (void*)BM0__map_to_allocations(error, allocations, (unsigned long long)regs[argument_1], (unsigned long long)regs[argument_2], (unsigned long long)regs[argument_3], (unsigned long long)regs[argument_4], (unsigned long long)regs[argument_5], &address);
+        BM0__unlock_allocations(allocations);
+        regs[return_value_destination_register] = address;
+
+        break;
+    case BM0__st__munmap:
+        // takes the handle given by mmap, deallocate does the same
+        BM0__lock_allocations(allocations);
+        if ((unsigned long long)regs[argument_1] < (*allocations).p_slot_count && (*allocations).p_types[(unsigned long long)regs[argument_1]] == BM0__att__mapping) {
+            BM0__deallocate_buffer_from_allocations(error, allocations, (unsigned long long)regs[argument_1]);
+            regs[return_value_destination_register] = (void*)(unsigned long long)0;
+        } else {
+            *error = BM0__et__deallocation_failure;
+            regs[return_value_destination_register] = (void*)(unsigned long long)-1ll;
+        }
+        BM0__unlock_allocations(allocations);
+
+        break;
+    case BM0__st__madvise:
+        regs[return_value_destination_register] = (void*)(unsigned long long)madvise(regs[argument_1], (size_t)(unsigned long long)regs[argument_2], (int)(unsigned long long)regs[argument_3]);
+
+        break;
+    case BM0__st__mremap:
+        BM0__lock_allocations(allocations);
+        regs[return_value_destination_register] = BM0__remap_allocation(error, allocations, (unsigned long long)regs[argument_1], (unsigned long long)regs[argument_2], (unsigned long long)regs[argument_3]);
+        BM0__unlock_allocations(allocations);
+
+        break;
+    case BM0__st__readv:
+    case BM0__st__writev:
+        // the second argument points to an array of buffers, the third is how many there are
+        if (BM0__create_io_vectors((BM0__buffer*)regs[argument_2], (unsigned long long)regs[argument_3], io_vectors) == BM0__boolean__false) {
+            regs[return_value_destination_register] = (void*)(unsigned long long)-1ll;
+
+            break;
+        }
+        if (syscall_number == BM0__st__readv) {
+            regs[return_value_destination_register] = (void*)(unsigned long long)readv((int)(unsigned long long)regs[argument_1], io_vectors, (int)(unsigned long long)regs[argument_3]);
+        } else {
+            regs[return_value_destination_register] = (void*)(unsigned long long)writev((int)(unsigned long long)regs[argument_1], io_vectors, (int)(unsigned long long)regs[argument_3]);
+        }
+
+        break;
+    case BM0__st__pread:
+        regs[return_value_destination_register] = (void*)(unsigned long long)pread((int)(unsigned long long)regs[argument_1], regs[argument_2], (size_t)(unsigned long long)regs[argument_3], (off_t)(unsigned long long)regs[argument_4]);
+
+        break;
+    case BM0__st__pwrite:
+        regs[return_value_destination_register] = (void*)(unsigned long long)pwrite((int)(unsigned long long)regs[argument_1], regs[argument_2], (size_t)(unsigned long long)regs[argument_3], (off_t)(unsigned long long)regs[argument_4]);
+
+        break;
+    case BM0__st__sendfile:
+        // output file, input file, input offset register (moved forward unless all of its bits are set) and length
+        offset_pointer_1 = BM0__get_syscall_offset(regs, argument_3, &offset_1);
+        regs[return_value_destination_register] = (void*)(unsigned long long)sendfile((int)(unsigned long long)regs[argument_1], (int)(unsigned long long)regs[argument_2], offset_pointer_1, (size_t)(unsigned long long)regs[argument_4]);
+        if (offset_pointer_1 != 0) {
+            regs[argument_3] = (void*)(unsigned long long)offset_1;
+        }
+
+        break;
+    case BM0__st__copy_file_range:
+        // input file, input offset register, output file, output offset register, length and flags, offsets behave like sendfile's
+        offset_pointer_1 = BM0__get_syscall_offset(regs, argument_2, &offset_1);
+        offset_pointer_2 = BM0__get_syscall_offset(regs, argument_4, &offset_2);
+        regs[return_value_destination_register] = (void*)(unsigned long long)syscall(__NR_copy_file_range, (int)(unsigned long long)regs[argument_1], offset_pointer_1, (int)(unsigned long long)regs[argument_3], offset_pointer_2, (size_t)(unsigned long long)regs[argument_5], (unsigned int)(unsigned long long)regs[argument_6]);
+        if (offset_pointer_1 != 0) {
+            regs[argument_2] = (void*)(unsigned long long)offset_1;
+        }
+        if (offset_pointer_2 != 0) {
+            regs[argument_4] = (void*)(unsigned long long)offset_2;
+        }
+
+        break;
+    case BM0__st__futex_wait:
+        // sleeps while the 32 bit value at the address equals the expected value, for at most the timeout in nanoseconds unless all of its bits are set
+        timeout.tv_sec = (time_t)((unsigned long long)regs[argument_3] / 1000000000ull);
+        timeout.tv_nsec = (long)((unsigned long long)regs[argument_3] % 1000000000ull);
+        regs[return_value_destination_register] = (void*)(unsigned long long)syscall(SYS_futex, regs[argument_1], FUTEX_WAIT_PRIVATE, (unsigned int)(unsigned long long)regs[argument_2], (unsigned long long)regs[argument_3] == ~0ull ? 0 : &timeout, 0, 0);
+        if (regs[return_value_destination_register] == (void*)(unsigned long long)-1ll) {
+            regs[return_value_destination_register] = (void*)(unsigned long long)-(long long)errno;
+        }
+
+        break;
+    case BM0__st__futex_wake:
+        // wakes at most the given amount of threads sleeping on the address
+        regs[return_value_destination_register] = (void*)(unsigned long long)syscall(SYS_futex, regs[argument_1], FUTEX_WAKE_PRIVATE, (int)(unsigned long long)regs[argument_2], 0, 0, 0);
+
+        break;
+    default:
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+// names as they are written in BM0__it, BM0__ot, BM0__st, BM0__aot and BM0__hot
+char* BM0__get_instruction_name(unsigned long long instruction) {
+    static char* names[] = {
+        "quit",
+        "write_register",
+        "allocate",
+        "deallocate",
+        "buffer_to_register",
+        "register_to_register",
+        "register_to_buffer",
+        "operate",
+        "do_x86_64_linux_syscall_limited",
+        "buffer_to_buffer",
+        "fill_buffer",
+        "compare_buffers",
+        "buffer_to_vector",
+        "vector_to_buffer",
+        "register_to_vector",
+        "vector_operate",
+        "reduce_vector",
+        "submit_io",
+        "complete_io",
+        "send_to_channel",
+        "receive_from_channel",
+        "spawn",
+        "join",
+        "atomic_operate",
+        "allocate_with_policy",
+        "hash_table_operate"
+    };
+
+    if (instruction >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[instruction];
+}
+
+char* BM0__get_operation_name(unsigned long long operation) {
+    static char* names[] = {
+        "binary__right_shift",
+        "binary__left_shift",
+        "binary__not",
+        "binary__and",
+        "binary__or",
+        "binary__xor",
+        "integer__add",
+        "integer__subtract",
+        "integer__multiply",
+        "integer__divide",
+        "integer__modulous",
+        "comparison__less_than",
+        "comparison__equal_to",
+        "comparison__not_equal_to",
+        "comparison__greater_than"
+    };
+
+    if (operation >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[operation];
+}
+
+char* BM0__get_vector_operation_name(unsigned long long operation) {
+    static char* names[] = {
+        "binary__right_shift",
+        "binary__left_shift",
+        "binary__not",
+        "binary__and",
+        "binary__or",
+        "binary__xor",
+        "integer__add",
+        "integer__subtract",
+        "integer__minimum",
+        "integer__maximum",
+        "comparison__less_than",
+        "comparison__equal_to",
+        "comparison__not_equal_to",
+        "comparison__greater_than"
+    };
+
+    if (operation >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[operation];
+}
+
+char* BM0__get_syscall_name(unsigned long long syscall_number) {
+    static char* names[] = {
+        "read",
+        "write",
+        "open",
+        "close",
+        "stat",
+        "fstat",
+        "mmap",
+        "munmap",
+        "madvise",
+        "mremap",
+        "readv",
+        "writev",
+        "pread",
+        "pwrite",
+        "sendfile",
+        "copy_file_range",
+        "futex_wait",
+        "futex_wake"
+    };
+
+    if (syscall_number >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[syscall_number];
+}
+
+char* BM0__get_atomic_operation_name(unsigned long long operation) {
+    static char* names[] = {
+        "load",
+        "exchange",
+        "compare_exchange",
+        "fetch_add",
+        "fetch_subtract",
+        "fetch_and",
+        "fetch_or",
+        "fetch_xor",
+        "fence"
+    };
+
+    if (operation >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[operation];
+}
+
+char* BM0__get_hash_table_operation_name(unsigned long long operation) {
+    static char* names[] = {
+        "create",
+        "insert",
+        "lookup",
+        "add",
+        "delete",
+        "iterate",
+        "count",
+        "clear"
+    };
+
+    if (operation >= sizeof(names) / sizeof(names[0])) {
+        return "unknown";
+    }
+
+    return names[operation];
+}
+
+// checks the input and sets up the registers for a run with an existing allocation table
+BM0__boolean BM0__prepare_byte_machine(BM0__et* error, BM0__buffer input_buffers_buffer, void** regs, BM0__vector* vectors) {
+    // check input for at least one buffer
+    if ((input_buffers_buffer.p_length < sizeof(BM0__buffer) && input_buffers_buffer.p_length > (sizeof(BM0__buffer) * BM0__define__max_input_sub_buffer_count)) || input_buffers_buffer.p_length % sizeof(BM0__buffer) != 0) {
+        *error = BM0__et__invalid_input_buffer;
+
+        return BM0__boolean__false;
+    }
+
+    // setup
+    *error = BM0__et__no_error;
+    for (unsigned long long i = 0; i < BM0__define__register_count; i++) {
+        regs[i] = 0;
+    }
+    BM0__zero_bytes(vectors, sizeof(BM0__vector) * BM0__define__vector_register_count);
+    regs[BM0__rt__instruction_pointer_register] = ((BM0__buffer*)(input_buffers_buffer.p_data))[0].p_data; // setup instruction pointer
+    regs[BM0__rt__input_buffers_pointer_register] = input_buffers_buffer.p_data; // setup the pointer to the input buffers
+    regs[BM0__rt__input_buffers_length_register] = (void*)input_buffers_buffer.p_length; // setup the length of the input buffers
+
+    return BM0__boolean__true;
+}
+
+BM0__allocations* BM0__setup_byte_machine(BM0__et* error, BM0__buffer input_buffers_buffer, void** regs, BM0__vector* vectors, BM0__arena* arena, unsigned long long max_allocation_count) {
+    BM0__allocations* allocations;
+
+    if (BM0__prepare_byte_machine(error, input_buffers_buffer, regs, vectors) == BM0__boolean__false) {
+        return 0;
+    }
+
+    // allocations
+    allocations = BM0__create_null_allocations(max_allocation_count, arena);
+    if (allocations == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+
+    return allocations;
+}
+
+/* Byte Machine - Threads */
+// runs one instruction of a machine, threads are handed the engine that spawned them
+typedef BM0__boolean (*BM0__step)(BM0__et* error, void** regs, BM0__vector* vectors, BM0__allocations* allocations, BM0__buffer* output, BM0__boolean final_debug_info);
+
+// a thread inside a byte machine, with its own registers and the machine's input buffers and allocations
+typedef struct BM0__sibling {
+    BM0__vector p_vectors[BM0__define__vector_register_count];
+    void* p_regs[BM0__define__register_count];
+    BM0__allocations* p_allocations;
+    BM0__step p_step;
+    pthread_t p_thread;
+    BM0__et p_error; // the critical error the thread ended with
+    BM0__buffer p_output; // given to quit
+    BM0__boolean p_joined; // taken by a join, so only one thread waits for it
+} BM0__sibling;
+
+// thread numbers count up from 1 and are not reused within a run
+typedef struct BM0__siblings {
+    BM0__sibling* p_threads[BM0__define__max_thread_count];
+    unsigned long long p_count;
+} BM0__siblings;
+
+void* BM0__run_sibling(void* argument) {
+    BM0__sibling* sibling = (BM0__sibling*)argument;
+
+    while ((*sibling).p_step(&(*sibling).p_error, (*sibling).p_regs, (*sibling).p_vectors, (*sibling).p_allocations, &(*sibling).p_output, BM0__boolean__false)) {}
+
+    return 0;
+}
+
+// starts a thread at an address with a copy of the spawning thread's registers, returns its number or zero when no thread could be started
+unsigned long long BM0__spawn_sibling(BM0__et* error, void** regs, BM0__vector* vectors, BM0__allocations* allocations, void* instruction_pointer, unsigned char thread_number_destination_register, BM0__step step) {
+    BM0__sibling* sibling;
+    unsigned long long thread_number;
+
+    // the first spawn makes the table shared, only this thread is running until the new one starts
+    if ((*allocations).p_siblings == 0) {
+        (*allocations).p_siblings = (BM0__siblings*)BM0__allocate(sizeof(BM0__siblings));
+        if ((*allocations).p_siblings == 0) {
+            *error = BM0__et__allocation_failure__os_rejected_request;
+
+            return 0;
+        }
+    }
+
+    // take a thread number
+    BM0__lock_allocations(allocations);
+    if ((*(*allocations).p_siblings).p_count == BM0__define__max_thread_count) {
+        BM0__unlock_allocations(allocations);
+        *error = BM0__et__thread_unavailable;
+
+        return 0;
+    }
+    sibling = (BM0__sibling*)BM0__allocate(sizeof(BM0__sibling));
+    if (sibling == 0) {
+        BM0__unlock_allocations(allocations);
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    thread_number = (*(*allocations).p_siblings).p_count + 1;
+
+    // setup registers, both threads get the thread number
+    regs[thread_number_destination_register] = (void*)thread_number;
+    BM0__copy_bytes(regs, sizeof((*sibling).p_regs), (*sibling).p_regs);
+    BM0__copy_bytes(vectors, sizeof((*sibling).p_vectors), (*sibling).p_vectors);
+    (*sibling).p_regs[BM0__rt__instruction_pointer_register] = instruction_pointer;
+    (*sibling).p_allocations = allocations;
+    (*sibling).p_step = step;
+    (*sibling).p_error = BM0__et__no_error;
+    (*sibling).p_output = BM0__create_null_buffer();
+    (*sibling).p_joined = BM0__boolean__false;
+
+    // start
+    if (pthread_create(&(*sibling).p_thread, 0, BM0__run_sibling, sibling) != 0) {
+        BM0__unlock_allocations(allocations);
+        BM0__deallocate(sibling, sizeof(BM0__sibling));
+        regs[thread_number_destination_register] = 0;
+        *error = BM0__et__thread_unavailable;
+
+        return 0;
+    }
+    (*(*allocations).p_siblings).p_threads[thread_number - 1] = sibling;
+    (*(*allocations).p_siblings).p_count = thread_number;
+    BM0__unlock_allocations(allocations);
+
+    return thread_number;
+}
+
+// waits for a thread to quit and returns the pointer it quit with, a critical error it ended with becomes an error of the joining thread
+void* BM0__join_sibling(BM0__et* error, BM0__allocations* allocations, unsigned long long thread_number) {
+    BM0__sibling* sibling = 0;
+
+    // claim the thread, only one join may wait for it and a thread can never wait for itself
+    BM0__lock_allocations(allocations);
+    if ((*allocations).p_siblings != 0 && thread_number - 1 < (*(*allocations).p_siblings).p_count && (*(*(*allocations).p_siblings).p_threads[thread_number - 1]).p_joined == BM0__boolean__false && pthread_equal(pthread_self(), (*(*(*allocations).p_siblings).p_threads[thread_number - 1]).p_thread) == 0) {
+        sibling = (*(*allocations).p_siblings).p_threads[thread_number - 1];
+        (*sibling).p_joined = BM0__boolean__true;
+    }
+    BM0__unlock_allocations(allocations);
+    if (sibling == 0) {
+        *error = BM0__et__thread_unavailable;
+
+        return 0;
+    }
+
+    // wait without the lock, the thread may still need it, a failed join leaves it for BM0__wait_for_siblings
+    if (pthread_join((*sibling).p_thread, 0) != 0) {
+        BM0__lock_allocations(allocations);
+        (*sibling).p_joined = BM0__boolean__false;
+        BM0__unlock_allocations(allocations);
+        *error = BM0__et__thread_unavailable;
+
+        return 0;
+    }
+    if ((*sibling).p_error != BM0__et__no_error) {
+        *error = (*sibling).p_error;
+    }
+
+    return (*sibling).p_output.p_data;
+}
+
+// waits for every thread nobody joined, a machine is only done once all of its threads are, called by the thread that started the machine
+void BM0__wait_for_siblings(BM0__allocations* allocations) {
+    BM0__siblings* siblings = (*allocations).p_siblings;
+    BM0__sibling* sibling;
+
+    if (siblings == 0) {
+        return;
+    }
+
+    // threads can still spawn more threads while being waited for, each one is claimed the same way join does
+    for (unsigned long long i = 0; ; i++) {
+        sibling = 0;
+        BM0__lock_allocations(allocations);
+        if (i == (*siblings).p_count) {
+            BM0__unlock_allocations(allocations);
+
+            break;
+        }
+        if ((*(*siblings).p_threads[i]).p_joined == BM0__boolean__false) {
+            sibling = (*siblings).p_threads[i];
+            (*sibling).p_joined = BM0__boolean__true;
+        }
+        BM0__unlock_allocations(allocations);
+        if (sibling != 0) {
+            pthread_join((*sibling).p_thread, 0);
+        }
+    }
+
+    // every thread that joined another one is gone by now
+    for (unsigned long long i = 0; i < (*siblings).p_count; i++) {
+        BM0__deallocate((*siblings).p_threads[i], sizeof(BM0__sibling));
+    }
+    BM0__deallocate(siblings, sizeof(BM0__siblings));
+    (*allocations).p_siblings = 0;
+
+    return;
+}
+
+// performs an atomic operation on the 8 bytes at an 8 byte aligned address, returns false for an unknown operation
+BM0__boolean BM0__perform_atomic_operation(BM0__et* error, void** regs, unsigned char operation, unsigned char pointer_register, unsigned char value_register, unsigned char expected_register, unsigned char destination_register) {
+    unsigned long long* address = (unsigned long long*)regs[pointer_register];
+    unsigned long long value = (unsigned long long)regs[value_register];
+    unsigned long long expected = (unsigned long long)regs[expected_register];
+
+    if (operation > BM0__aot__fence) {
+        return BM0__boolean__false;
+    }
+    if (operation == BM0__aot__fence) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        return BM0__boolean__true;
+    }
+    if (((unsigned long long)address & (sizeof(unsigned long long) - 1)) != 0) {
+        *error = BM0__et__unaligned_atomic_address;
+
+        return BM0__boolean__true;
+    }
+
+    switch ((BM0__aot)operation) {
+    case BM0__aot__load:
+        regs[destination_register] = (void*)__atomic_load_n(address, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__exchange:
+        regs[destination_register] = (void*)__atomic_exchange_n(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__compare_exchange:
+        // the old value is written either way, it equals the expected value when the store happened
+        __atomic_compare_exchange_n(address, &expected, value, BM0__boolean__false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        regs[destination_register] = (void*)expected;
+
+        break;
+    case BM0__aot__fetch_add:
+        regs[destination_register] = (void*)__atomic_fetch_add(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__fetch_subtract:
+        regs[destination_register] = (void*)__atomic_fetch_sub(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__fetch_and:
+        regs[destination_register] = (void*)__atomic_fetch_and(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__fetch_or:
+        regs[destination_register] = (void*)__atomic_fetch_or(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    case BM0__aot__fetch_xor:
+        regs[destination_register] = (void*)__atomic_fetch_xor(address, value, __ATOMIC_SEQ_CST);
+
+        break;
+    default:
+        break;
+    }
+
+    return BM0__boolean__true;
+}
+
+// runs exactly one instruction, returns false once the machine has quit or hit a critical error
+BM0__boolean BM0__step_byte_machine(BM0__et* error, void** regs, BM0__vector* vectors, BM0__allocations* allocations, BM0__buffer* output, BM0__boolean final_debug_info) {
+    // clear necessary registers
+    regs[BM0__rt__instruction_parameter_register_0] = 0;
+    regs[BM0__rt__instruction_parameter_register_1] = 0;
+    regs[BM0__rt__instruction_parameter_register_2] = 0;
+    regs[BM0__rt__instruction_parameter_register_3] = 0;
+    regs[BM0__rt__instruction_parameter_register_4] = 0;
+    regs[BM0__rt__instruction_parameter_register_5] = 0;
+    regs[BM0__rt__instruction_parameter_register_6] = 0;
+    regs[BM0__rt__instruction_parameter_register_7] = 0;
+
+    // get instruction ID
+    BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register], 2, (void*)&regs[BM0__rt__instruction_ID_register]);
+
+    // go to proper instruction's operations
+    switch ((BM0__it)(unsigned short)(unsigned long long)regs[BM0__rt__instruction_ID_register]) {
+    case BM0__it__quit:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        (*output).p_data = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]];
+        (*output).p_length = (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]];
+
+#ifdef BM0__enable__trace
+        // the context prints the trace instead
+        if (final_debug_info == BM0__boolean__true && (*allocations).p_trace != 0) {
+            return BM0__boolean__false;
+        }
+#endif
+        if (final_debug_info == BM0__boolean__true) {
+            printf("Instruction 'quit' called, dumping registers, dumping output and quitting byte machine...\n");
+
+            for (unsigned long long i = 0; i < 32; i++) {
+                printf("\t[ ");
+
+                for (unsigned long long j = 0; j < 8; j++) {
+                    printf("%llu ", (unsigned long long)regs[(i * 8) + j]);
+                }
+
+                printf("]\n");
+            }
+
+            printf("\tOutput: [ %llu, %llu ]\n", (unsigned long long)(*output).p_data, (unsigned long long)(*output).p_length);
+        }
+
+        return BM0__boolean__false;
+    case BM0__it__write_register:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 8, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]] = regs[BM0__rt__instruction_parameter_register_1];
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__write_register);
+
+        break;
+    case BM0__it__allocate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = (void*)BM0__allocate_buffer_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (*allocations).p_policy);
+        if (regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] < (void*)(*allocations).p_slot_count) {
+            // allocate
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_data;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_length);
+        } else {
+            // make registers null
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = 0;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = 0;
+        }
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__allocate);
+
+        break;
+    case BM0__it__deallocate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        BM0__deallocate_buffer_from_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__deallocate);
+
+        break;
+    case BM0__it__buffer_to_register:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        if ((unsigned long long)regs[BM0__rt__instruction_parameter_register_1] <= sizeof(unsigned long long)) {
+            BM0__copy_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (void*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+        } else {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__invalid_byte_transfer_size;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__buffer_to_register);
+
+        break;
+    case BM0__it__register_to_register:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]];
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_register);
+
+        break;
+    case BM0__it__register_to_buffer:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        if ((unsigned long long)regs[BM0__rt__instruction_parameter_register_1] <= sizeof(unsigned long long)) {
+            BM0__copy_bytes((void*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[BM0__rt__instruction_parameter_register_1], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+        } else {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)BM0__et__invalid_byte_transfer_size;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_buffer);
+
+        break;
+    case BM0__it__operate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 7, 1, &regs[BM0__rt__instruction_parameter_register_5]);
+
+        // perform action
+        switch (BM0__get_operate_mode((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1])) {
+        case BM0__omt__flag_bit__direct_operation:
+            // use if wanting byte machine to look for bit and get operation directly from operation parameter
+            regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__false;
+            regs[BM0__rt__instruction_parameter_register_7] = (void*)regs[BM0__rt__instruction_parameter_register_2];
+
+            break;
+        case BM0__omt__flag_bit__register_operation:
+            // use if wanting byte machine to look for bit and get operation from operation parameter's specified register
+            regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__false;
+            regs[BM0__rt__instruction_parameter_register_7] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]];
+
+            break;
+        case BM0__omt__always__direct_operation:
+            // use if wanting byte machine to always perform operation and get operation directly from operation parameter
+            regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__true;
+            regs[BM0__rt__instruction_parameter_register_7] = (void*)regs[BM0__rt__instruction_parameter_register_2];
+
+            break;
+        case BM0__omt__always__register_operation:
+            // use if wanting byte machine to always perform operation and get operation from operation parameter's specified register
+            regs[BM0__rt__instruction_parameter_register_6] = (void*)(unsigned long long)(unsigned short)BM0__boolean__true;
+            regs[BM0__rt__instruction_parameter_register_7] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]];
+
+            break;
+        }
+
+        if (regs[BM0__rt__instruction_parameter_register_6] || ((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]] & BM0__get_operate_flag_mask((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1])) > 0) {
+            if (BM0__perform_operation(regs, (unsigned short)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5]) == BM0__boolean__false) {
+                // in case there is an invalid / unimplemented operation ID
+                *error = BM0__et__unimplemented_operation;
+
+                return BM0__boolean__false;
+            }
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__operate);
+
+        break;
+    case BM0__it__do_x86_64_linux_syscall_limited:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 7, 1, &regs[BM0__rt__instruction_parameter_register_5]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 8, 1, &regs[BM0__rt__instruction_parameter_register_6]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 9, 1, &regs[BM0__rt__instruction_parameter_register_7]);
+
+        // perform action
+        if (BM0__perform_syscall(regs, allocations, (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_6], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7]) == BM0__boolean__false) {
+            *error = BM0__et__unimplemented_syscall;
+
+            return BM0__boolean__false;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__do_x86_64_linux_syscall_limited);
+
+        break;
+    case BM0__it__buffer_to_buffer:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        BM0__move_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__buffer_to_buffer);
+
+        break;
+    case BM0__it__fill_buffer:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        BM0__fill_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], (unsigned char)(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__fill_buffer);
+
+        break;
+    case BM0__it__compare_buffers:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+
+        // perform action
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)BM0__compare_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__compare_buffers);
+
+        break;
+    case BM0__it__buffer_to_vector:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        BM0__copy_bytes(regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], BM0__define__vector_register_length, &vectors[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__buffer_to_vector);
+
+        break;
+    case BM0__it__vector_to_buffer:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        BM0__copy_bytes(&vectors[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], BM0__define__vector_register_length, regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__vector_to_buffer);
+
+        break;
+    case BM0__it__register_to_vector:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        if (BM0__broadcast_to_vector(vectors, (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]) == BM0__boolean__false) {
+            *error = BM0__et__unimplemented_operation;
+
+            return BM0__boolean__false;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_vector);
+
+        break;
+    case BM0__it__vector_operate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 7, 1, &regs[BM0__rt__instruction_parameter_register_5]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 8, 1, &regs[BM0__rt__instruction_parameter_register_6]);
+
+        // perform action, flags and operation are found the same way as operate
+        switch (BM0__get_operate_mode((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1])) {
+        case BM0__omt__flag_bit__direct_operation:
+        case BM0__omt__always__direct_operation:
+            regs[BM0__rt__instruction_parameter_register_7] = (void*)regs[BM0__rt__instruction_parameter_register_2];
+
+            break;
+        case BM0__omt__flag_bit__register_operation:
+        case BM0__omt__always__register_operation:
+            regs[BM0__rt__instruction_parameter_register_7] = regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]];
+
+            break;
+        }
+
+        if (BM0__get_operate_mode((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]) >= BM0__omt__always__direct_operation || ((unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]] & BM0__get_operate_flag_mask((unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1])) > 0) {
+            if (BM0__perform_vector_operation(vectors, (unsigned short)(unsigned long long)regs[BM0__rt__instruction_parameter_register_7], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_5], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_6]) == BM0__boolean__false) {
+                // in case there is an invalid / unimplemented operation ID or lane type
+                *error = BM0__et__unimplemented_operation;
+
+                return BM0__boolean__false;
+            }
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__vector_operate);
+
+        break;
+    case BM0__it__reduce_vector:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+
+        // perform action
+        if (BM0__perform_vector_reduction(regs, vectors, (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]) == BM0__boolean__false) {
+            *error = BM0__et__unimplemented_operation;
+
+            return BM0__boolean__false;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__reduce_vector);
+
+        break;
+    case BM0__it__submit_io:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (void*)BM0__submit_io_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (BM0__io_request*)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__submit_io);
+
+        break;
+    case BM0__it__complete_io:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)BM0__complete_io_from_allocations(allocations, (BM0__io_completion*)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]);
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__complete_io);
+
+        break;
+    case BM0__it__send_to_channel:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (void*)(unsigned long long)BM0__send_allocation_to_channel((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__send_to_channel);
+
+        break;
+    case BM0__it__receive_from_channel:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = (void*)BM0__receive_allocation_from_channel((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
+        if (regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] < (void*)(*allocations).p_slot_count) {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_data;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]].p_length);
+        } else {
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = 0;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = 0;
+        }
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__receive_from_channel);
+
+        break;
+    case BM0__it__spawn:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // change instruction index first, the new thread starts with a copy of every register
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__spawn);
+
+        // perform action
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = (void*)BM0__spawn_sibling((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], regs, vectors, allocations, regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1], BM0__step_byte_machine);
+
+        break;
+    case BM0__it__join:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+
+        // perform action
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]] = BM0__join_sibling((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]]);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__join);
+
+        break;
+    case BM0__it__atomic_operate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+
+        // perform action
+        if (BM0__perform_atomic_operation((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], regs, (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]) == BM0__boolean__false) {
+            // in case there is an invalid / unimplemented atomic operation ID
+            *error = BM0__et__unimplemented_operation;
+
+            return BM0__boolean__false;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__atomic_operate);
+
+        break;
+    case BM0__it__allocate_with_policy:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+
+        // perform action
+        BM0__lock_allocations(allocations);
+        regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] = (void*)BM0__allocate_buffer_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0]], (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1]]);
+        if (regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]] < (void*)(*allocations).p_slot_count) {
+            // allocate
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = (*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]].p_data;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2]]].p_length);
+        } else {
+            // make registers null
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3]] = 0;
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]] = 0;
+        }
+        BM0__unlock_allocations(allocations);
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__allocate_with_policy);
+
+        break;
+    case BM0__it__hash_table_operate:
+        // read parameters
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 2, 1, &regs[BM0__rt__instruction_parameter_register_0]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 3, 1, &regs[BM0__rt__instruction_parameter_register_1]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 4, 1, &regs[BM0__rt__instruction_parameter_register_2]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 5, 1, &regs[BM0__rt__instruction_parameter_register_3]);
+        BM0__copy_bytes(regs[BM0__rt__instruction_pointer_register] + 6, 1, &regs[BM0__rt__instruction_parameter_register_4]);
+
+        // perform action
+        if (BM0__perform_hash_table_operation((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], regs, allocations, (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_0], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_1], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_2], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_3], (unsigned char)(unsigned long long)regs[BM0__rt__instruction_parameter_register_4]) == BM0__boolean__false) {
+            // in case there is an invalid / unimplemented hash table operation ID
+            *error = BM0__et__unimplemented_operation;
+
+            return BM0__boolean__false;
+        }
+
+        // change instruction index
+        BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__hash_table_operate);
+
+        break;
+    // in case no instruction is matched
+    default:
+        *error = BM0__et__unimplemented_instruction_ID;
+
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+BM0__buffer BM0__run_byte_machine(BM0__et* error, BM0__buffer input_buffers_buffer, BM0__boolean final_debug_info) {
+    // output
+    BM0__buffer output = BM0__create_null_buffer();
+
+    // registers
+    void* regs[BM0__define__register_count];
+    BM0__vector vectors[BM0__define__vector_register_count];
+
+    // allocations
+    BM0__allocations* allocations = BM0__setup_byte_machine(error, input_buffers_buffer, regs, vectors, 0, BM0__define__max_allocation_count);
+
+    if (allocations == 0) {
+        return output;
+    }
+
+    // process instructions
+    while (BM0__step_byte_machine(error, regs, vectors, allocations, &output, final_debug_info)) {}
+
+    // clean up
+    BM0__wait_for_siblings(allocations);
+    BM0__destroy_allocations(allocations);
+
+    return output;
+}
+
+/* Profiler */
+#ifdef BM0__enable__profiler
+typedef struct BM0__profile_counter {
+    unsigned long long p_count;
+    unsigned long long p_cycles;
+} BM0__profile_counter;
+
+// one per program byte, the instruction last seen there is kept for the folded stacks
+typedef struct BM0__profile_offset {
+    BM0__profile_counter p_counter;
+    unsigned short p_instruction;
+    unsigned short p_detail; // the operation or syscall, 0xFFFF for other instructions
+} BM0__profile_offset;
+
+// instructions, operations, vector operations and syscalls are counted by their encoded number, anything from 256 on is not valid
+typedef struct BM0__profile {
+    BM0__profile_counter p_instructions[256];
+    BM0__profile_counter p_operations[256];
+    BM0__profile_counter p_vector_operations[256];
+    BM0__profile_counter p_syscalls[256];
+    BM0__profile_counter p_outside_program; // instructions run from outside of input buffer 0
+    BM0__buffer p_program; // input buffer 0, not owned by the profile
+    BM0__profile_offset* p_offsets;
+
+    // the instruction being timed, its cycles are counted once the next one starts
+    unsigned long long p_start;
+    BM0__profile_counter* p_current_instruction; // zero when nothing is being timed
+    BM0__profile_counter* p_current_detail;
+    BM0__profile_counter* p_current_offset;
+} BM0__profile;
+
+unsigned long long BM0__read_profile_clock() {
+#ifdef __x86_64__
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return ((unsigned long long)time.tv_sec * 1000000000ull) + (unsigned long long)time.tv_nsec;
+#endif
+}
+
+// the profile covers the program in input buffer 0
+BM0__profile* BM0__create_profile(BM0__et* error, BM0__buffer program) {
+    BM0__profile* profile = (BM0__profile*)BM0__allocate(sizeof(BM0__profile) + (sizeof(BM0__profile_offset) * program.p_length));
+
+    if (profile == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    (*profile).p_program = program;
+    (*profile).p_offsets = (BM0__profile_offset*)(profile + 1);
+    (*profile).p_current_instruction = 0;
+    *error = BM0__et__no_error;
+
+    return profile;
+}
+
+void BM0__destroy_profile(BM0__profile* profile) {
+    BM0__deallocate(profile, sizeof(BM0__profile) + (sizeof(BM0__profile_offset) * (*profile).p_program.p_length));
+
+    return;
+}
+
+void BM0__stop_profiling_instruction(BM0__profile* profile) {
+    unsigned long long cycles;
+
+    if ((*profile).p_current_instruction == 0) {
+        return;
+    }
+
+    cycles = BM0__read_profile_clock() - (*profile).p_start;
+    (*(*profile).p_current_instruction).p_cycles += cycles;
+    if ((*profile).p_current_detail != 0) {
+        (*(*profile).p_current_detail).p_cycles += cycles;
+    }
+    (*(*profile).p_current_offset).p_cycles += cycles;
+    (*profile).p_current_instruction = 0;
+
+    return;
+}
+
+// counts the instruction at the instruction pointer and starts timing it, called right before it runs
+void BM0__profile_instruction(BM0__profile* profile, void** regs) {
+    unsigned char* instruction_pointer = (unsigned char*)regs[BM0__rt__instruction_pointer_register];
+    unsigned long long offset = (unsigned long long)(instruction_pointer - (unsigned char*)(*profile).p_program.p_data);
+    unsigned short opcode = 0;
+    unsigned long long detail = 0xFFFF;
+
+    BM0__stop_profiling_instruction(profile);
+
+    // find what runs, operations can come from a register
+    BM0__copy_bytes(instruction_pointer, 2, &opcode);
+    if (opcode >= 256) {
+        return;
+    }
+    if (opcode == BM0__it__operate || opcode == BM0__it__vector_operate) {
+        detail = instruction_pointer[4];
+        if (BM0__get_operate_mode(instruction_pointer[3]) == BM0__omt__flag_bit__register_operation || BM0__get_operate_mode(instruction_pointer[3]) == BM0__omt__always__register_operation) {
+            detail = (unsigned long long)regs[instruction_pointer[4]];
+        }
+    } else if (opcode == BM0__it__do_x86_64_linux_syscall_limited) {
+        detail = instruction_pointer[2];
+    }
+
+    // count
+    (*profile).p_current_instruction = &(*profile).p_instructions[opcode];
+    (*profile).p_current_detail = 0;
+    if (detail < 256) {
+        if (opcode == BM0__it__do_x86_64_linux_syscall_limited) {
+            (*profile).p_current_detail = &(*profile).p_syscalls[detail];
+        } else if (opcode == BM0__it__vector_operate) {
+            (*profile).p_current_detail = &(*profile).p_vector_operations[detail];
+        } else {
+            (*profile).p_current_detail = &(*profile).p_operations[detail];
+        }
+        (*(*profile).p_current_detail).p_count++;
+    }
+    (*profile).p_current_offset = &(*profile).p_outside_program;
+    if (offset < (*profile).p_program.p_length) {
+        (*profile).p_current_offset = &(*profile).p_offsets[offset].p_counter;
+        (*profile).p_offsets[offset].p_instruction = opcode;
+        (*profile).p_offsets[offset].p_detail = (unsigned short)(detail < 256 ? detail : 0xFFFF);
+    }
+    (*(*profile).p_current_instruction).p_count++;
+    (*(*profile).p_current_offset).p_count++;
+    (*profile).p_start = BM0__read_profile_clock();
+
+    return;
+}
+
+char* BM0__get_profile_detail_name(unsigned short instruction, unsigned short detail) {
+    if (instruction == BM0__it__do_x86_64_linux_syscall_limited) {
+        return BM0__get_syscall_name(detail);
+    }
+    if (instruction == BM0__it__vector_operate) {
+        return BM0__get_vector_operation_name(detail);
+    }
+
+    return BM0__get_operation_name(detail);
+}
+
+// one line per instruction, operation, vector operation, syscall and program offset that ran, with its run count and cycles
+void BM0__print_profile(BM0__profile* profile, FILE* file) {
+    fprintf(file, "kind\tname\tcount\tcycles\n");
+    for (unsigned long long i = 0; i < 256; i++) {
+        if ((*profile).p_instructions[i].p_count != 0) {
+            fprintf(file, "instruction\t%s\t%llu\t%llu\n", BM0__get_instruction_name(i), (*profile).p_instructions[i].p_count, (*profile).p_instructions[i].p_cycles);
+        }
+    }
+    for (unsigned long long i = 0; i < 256; i++) {
+        if ((*profile).p_operations[i].p_count != 0) {
+            fprintf(file, "operation\t%s\t%llu\t%llu\n", BM0__get_operation_name(i), (*profile).p_operations[i].p_count, (*profile).p_operations[i].p_cycles);
+        }
+    }
+    for (unsigned long long i = 0; i < 256; i++) {
+        if ((*profile).p_vector_operations[i].p_count != 0) {
+            fprintf(file, "vector_operation\t%s\t%llu\t%llu\n", BM0__get_vector_operation_name(i), (*profile).p_vector_operations[i].p_count, (*profile).p_vector_operations[i].p_cycles);
+        }
+    }
+    for (unsigned long long i = 0; i < 256; i++) {
+        if ((*profile).p_syscalls[i].p_count != 0) {
+            fprintf(file, "syscall\t%s\t%llu\t%llu\n", BM0__get_syscall_name(i), (*profile).p_syscalls[i].p_count, (*profile).p_syscalls[i].p_cycles);
+        }
+    }
+    for (unsigned long long i = 0; i < (*profile).p_program.p_length; i++) {
+        if ((*profile).p_offsets[i].p_counter.p_count != 0) {
+            fprintf(file, "offset\t%llu:%s\t%llu\t%llu\n", i, BM0__get_instruction_name((*profile).p_offsets[i].p_instruction), (*profile).p_offsets[i].p_counter.p_count, (*profile).p_offsets[i].p_counter.p_cycles);
+        }
+    }
+    if ((*profile).p_outside_program.p_count != 0) {
+        fprintf(file, "offset\toutside_program\t%llu\t%llu\n", (*profile).p_outside_program.p_count, (*profile).p_outside_program.p_cycles);
+    }
+
+    return;
+}
+
+// folded stacks (program;instruction;operation or syscall;offset cycles) for flame graph tools
+void BM0__print_profile_folded_stacks(BM0__profile* profile, FILE* file) {
+    BM0__profile_offset* offset;
+
+    for (unsigned long long i = 0; i < (*profile).p_program.p_length; i++) {
+        offset = &(*profile).p_offsets[i];
+        if ((*offset).p_counter.p_count == 0) {
+            continue;
+        }
+        if ((*offset).p_detail != 0xFFFF) {
+            fprintf(file, "program;%s;%s;offset_%llu %llu\n", BM0__get_instruction_name((*offset).p_instruction), BM0__get_profile_detail_name((*offset).p_instruction, (*offset).p_detail), i, (*offset).p_counter.p_cycles);
+        } else {
+            fprintf(file, "program;%s;offset_%llu %llu\n", BM0__get_instruction_name((*offset).p_instruction), i, (*offset).p_counter.p_cycles);
+        }
+    }
+    if ((*profile).p_outside_program.p_count != 0) {
+        fprintf(file, "program;outside_program %llu\n", (*profile).p_outside_program.p_cycles);
+    }
+
+    return;
+}
+#endif
+
+/* Create Instructions & Data */
+unsigned long long BM0__write_instruction__get_instruction_ilt(BM0__it opcode) {
+    switch (opcode) {
+    case BM0__it__quit:
+        return BM0__ilt__quit;
+    case BM0__it__write_register:
+        return BM0__ilt__write_register;
+    case BM0__it__allocate:
+        return BM0__ilt__allocate;
+    case BM0__it__deallocate:
+        return BM0__ilt__deallocate;
+    case BM0__it__buffer_to_register:
+        return BM0__ilt__buffer_to_register;
+    case BM0__it__register_to_register:
+        return BM0__ilt__register_to_register;
+    case BM0__it__register_to_buffer:
+        return BM0__ilt__register_to_buffer;
+    case BM0__it__operate:
+        return BM0__ilt__operate;
+    case BM0__it__do_x86_64_linux_syscall_limited:
+        return BM0__ilt__do_x86_64_linux_syscall_limited;
+    case BM0__it__buffer_to_buffer:
+        return BM0__ilt__buffer_to_buffer;
+    case BM0__it__fill_buffer:
+        return BM0__ilt__fill_buffer;
+    case BM0__it__compare_buffers:
+        return BM0__ilt__compare_buffers;
+    case BM0__it__buffer_to_vector:
+        return BM0__ilt__buffer_to_vector;
+    case BM0__it__vector_to_buffer:
+        return BM0__ilt__vector_to_buffer;
+    case BM0__it__register_to_vector:
+        return BM0__ilt__register_to_vector;
+    case BM0__it__vector_operate:
+        return BM0__ilt__vector_operate;
+    case BM0__it__reduce_vector:
+        return BM0__ilt__reduce_vector;
+    case BM0__it__submit_io:
+        return BM0__ilt__submit_io;
+    case BM0__it__complete_io:
+        return BM0__ilt__complete_io;
+    case BM0__it__send_to_channel:
+        return BM0__ilt__send_to_channel;
+    case BM0__it__receive_from_channel:
+        return BM0__ilt__receive_from_channel;
+    case BM0__it__spawn:
+        return BM0__ilt__spawn;
+    case BM0__it__join:
+        return BM0__ilt__join;
+    case BM0__it__atomic_operate:
+        return BM0__ilt__atomic_operate;
+    case BM0__it__allocate_with_policy:
+        return BM0__ilt__allocate_with_policy;
+    case BM0__it__hash_table_operate:
+        return BM0__ilt__hash_table_operate;
+    default:
+        return 0;
+    }
+}
+
+void* BM0__write_instruction__write_buffer_to_program(void* destination, BM0__buffer data) {
+    BM0__copy_bytes(data.p_data, data.p_length, destination);
+
+    return destination + data.p_length;
+}
+
+void* BM0__write_instruction__quit(void* destination, unsigned char buffer_pointer_source_register, unsigned char buffer_length_source_register) {
+    unsigned short opcode = BM0__it__quit;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&buffer_pointer_source_register, 1, destination + 2);
+    BM0__copy_bytes(&buffer_length_source_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__quit;
+}
+
+void* BM0__write_instruction__write_register(void* destination, unsigned char destination_register, unsigned long long value) {
+    unsigned short opcode = BM0__it__write_register;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&destination_register, 1, destination + 2);
+    BM0__copy_bytes(&value, sizeof(unsigned long long), destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__write_register;
+}
+
+void* BM0__write_instruction__allocate(void* destination, unsigned char allocation_size_register, unsigned char handle_destination_register, unsigned char pointer_destination_register, unsigned char length_destination_register) {
+    unsigned short opcode = BM0__it__allocate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&allocation_size_register, 1, destination + 2);
+    BM0__copy_bytes(&handle_destination_register, 1, destination + 3);
+    BM0__copy_bytes(&pointer_destination_register, 1, destination + 4);
+    BM0__copy_bytes(&length_destination_register, 1, destination + 5);
+
+    return destination + (unsigned long long)BM0__ilt__allocate;
+}
+
+void* BM0__write_instruction__deallocate(void* destination, unsigned char handle_register) {
+    unsigned short opcode = BM0__it__deallocate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&handle_register, 1, destination + 2);
+
+    return destination + (unsigned long long)BM0__ilt__deallocate;
+}
+
+void* BM0__write_instruction__buffer_to_register(void* destination, unsigned char source_pointer_register, unsigned char byte_count, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__buffer_to_register;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&byte_count, 1, destination + 3);
+    BM0__copy_bytes(&destination_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__buffer_to_register;
+}
+
+void* BM0__write_instruction__register_to_register(void* destination, unsigned char source_register, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__register_to_register;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_register, 1, destination + 2);
+    BM0__copy_bytes(&destination_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__register_to_register;
+}
+
+void* BM0__write_instruction__register_to_buffer(void* destination, unsigned char source_register, unsigned char byte_count, unsigned char destination_pointer_register) {
+    unsigned short opcode = BM0__it__register_to_buffer;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_register, 1, destination + 2);
+    BM0__copy_bytes(&byte_count, 1, destination + 3);
+    BM0__copy_bytes(&destination_pointer_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__register_to_buffer;
+}
+
+void* BM0__write_instruction__operate(void* destination, unsigned char flags_register_number, unsigned char required_flag_bit, unsigned char operation, unsigned char source_register_1, unsigned char source_register_2, unsigned char destination_register_1) {
+    unsigned short opcode = BM0__it__operate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&flags_register_number, 1, destination + 2);
+    BM0__copy_bytes(&required_flag_bit, 1, destination + 3);
+    BM0__copy_bytes(&operation, 1, destination + 4);
+    BM0__copy_bytes(&source_register_1, 1, destination + 5);
+    BM0__copy_bytes(&source_register_2, 1, destination + 6);
+    BM0__copy_bytes(&destination_register_1, 1, destination + 7);
+
+    return destination + (unsigned long long)BM0__ilt__operate;
+}
+
+void* BM0__write_instruction__do_x86_64_linux_syscall_limited(void* destination, unsigned char syscall_number, unsigned char argument_1, unsigned char argument_2, unsigned char argument_3, unsigned char argument_4, unsigned char argument_5, unsigned char argument_6, unsigned char return_value_destination_register) {
+    unsigned short opcode = BM0__it__do_x86_64_linux_syscall_limited;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&syscall_number, 1, destination + 2);
     BM0__copy_bytes(&argument_1, 1, destination + 3);
     BM0__copy_bytes(&argument_2, 1, destination + 4);
     BM0__copy_bytes(&argument_3, 1, destination + 5);
@@ -765,4 +4153,4130 @@ void* BM0__write_instruction__do_x86_64_linux_syscall_limited(void* destination,
     return destination + (unsigned long long)BM0__ilt__do_x86_64_linux_syscall_limited;
 }
 
+void* BM0__write_instruction__buffer_to_buffer(void* destination, unsigned char source_pointer_register, unsigned char byte_count_register, unsigned char destination_pointer_register) {
+    unsigned short opcode = BM0__it__buffer_to_buffer;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&byte_count_register, 1, destination + 3);
+    BM0__copy_bytes(&destination_pointer_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__buffer_to_buffer;
+}
+
+void* BM0__write_instruction__fill_buffer(void* destination, unsigned char value_register, unsigned char byte_count_register, unsigned char destination_pointer_register) {
+    unsigned short opcode = BM0__it__fill_buffer;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&value_register, 1, destination + 2);
+    BM0__copy_bytes(&byte_count_register, 1, destination + 3);
+    BM0__copy_bytes(&destination_pointer_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__fill_buffer;
+}
+
+void* BM0__write_instruction__compare_buffers(void* destination, unsigned char pointer_register_1, unsigned char pointer_register_2, unsigned char byte_count_register, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__compare_buffers;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&pointer_register_1, 1, destination + 2);
+    BM0__copy_bytes(&pointer_register_2, 1, destination + 3);
+    BM0__copy_bytes(&byte_count_register, 1, destination + 4);
+    BM0__copy_bytes(&destination_register, 1, destination + 5);
+
+    return destination + (unsigned long long)BM0__ilt__compare_buffers;
+}
+
+void* BM0__write_instruction__buffer_to_vector(void* destination, unsigned char source_pointer_register, unsigned char destination_vector_register) {
+    unsigned short opcode = BM0__it__buffer_to_vector;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&destination_vector_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__buffer_to_vector;
+}
+
+void* BM0__write_instruction__vector_to_buffer(void* destination, unsigned char source_vector_register, unsigned char destination_pointer_register) {
+    unsigned short opcode = BM0__it__vector_to_buffer;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&source_vector_register, 1, destination + 2);
+    BM0__copy_bytes(&destination_pointer_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__vector_to_buffer;
+}
+
+void* BM0__write_instruction__register_to_vector(void* destination, unsigned char lane_type, unsigned char source_register, unsigned char destination_vector_register) {
+    unsigned short opcode = BM0__it__register_to_vector;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&lane_type, 1, destination + 2);
+    BM0__copy_bytes(&source_register, 1, destination + 3);
+    BM0__copy_bytes(&destination_vector_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__register_to_vector;
+}
+
+void* BM0__write_instruction__vector_operate(void* destination, unsigned char flags_register_number, unsigned char required_flag_bit, unsigned char operation, unsigned char lane_type, unsigned char source_vector_register_1, unsigned char source_vector_register_2, unsigned char destination_vector_register) {
+    unsigned short opcode = BM0__it__vector_operate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&flags_register_number, 1, destination + 2);
+    BM0__copy_bytes(&required_flag_bit, 1, destination + 3);
+    BM0__copy_bytes(&operation, 1, destination + 4);
+    BM0__copy_bytes(&lane_type, 1, destination + 5);
+    BM0__copy_bytes(&source_vector_register_1, 1, destination + 6);
+    BM0__copy_bytes(&source_vector_register_2, 1, destination + 7);
+    BM0__copy_bytes(&destination_vector_register, 1, destination + 8);
+
+    return destination + (unsigned long long)BM0__ilt__vector_operate;
+}
+
+void* BM0__write_instruction__reduce_vector(void* destination, unsigned char reduction, unsigned char lane_type, unsigned char source_vector_register, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__reduce_vector;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&reduction, 1, destination + 2);
+    BM0__copy_bytes(&lane_type, 1, destination + 3);
+    BM0__copy_bytes(&source_vector_register, 1, destination + 4);
+    BM0__copy_bytes(&destination_register, 1, destination + 5);
+
+    return destination + (unsigned long long)BM0__ilt__reduce_vector;
+}
+
+void* BM0__write_instruction__submit_io(void* destination, unsigned char requests_pointer_register, unsigned char request_count_register, unsigned char submitted_count_destination_register) {
+    unsigned short opcode = BM0__it__submit_io;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&requests_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&request_count_register, 1, destination + 3);
+    BM0__copy_bytes(&submitted_count_destination_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__submit_io;
+}
+
+void* BM0__write_instruction__complete_io(void* destination, unsigned char completions_pointer_register, unsigned char maximum_count_register, unsigned char minimum_count_register, unsigned char completed_count_destination_register) {
+    unsigned short opcode = BM0__it__complete_io;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&completions_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&maximum_count_register, 1, destination + 3);
+    BM0__copy_bytes(&minimum_count_register, 1, destination + 4);
+    BM0__copy_bytes(&completed_count_destination_register, 1, destination + 5);
+
+    return destination + (unsigned long long)BM0__ilt__complete_io;
+}
+
+void* BM0__write_instruction__send_to_channel(void* destination, unsigned char channel_number_register, unsigned char handle_register, unsigned char sent_destination_register) {
+    unsigned short opcode = BM0__it__send_to_channel;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&channel_number_register, 1, destination + 2);
+    BM0__copy_bytes(&handle_register, 1, destination + 3);
+    BM0__copy_bytes(&sent_destination_register, 1, destination + 4);
+
+    return destination + (unsigned long long)BM0__ilt__send_to_channel;
+}
+
+void* BM0__write_instruction__receive_from_channel(void* destination, unsigned char channel_number_register, unsigned char handle_destination_register, unsigned char pointer_destination_register, unsigned char length_destination_register) {
+    unsigned short opcode = BM0__it__receive_from_channel;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&channel_number_register, 1, destination + 2);
+    BM0__copy_bytes(&handle_destination_register, 1, destination + 3);
+    BM0__copy_bytes(&pointer_destination_register, 1, destination + 4);
+    BM0__copy_bytes(&length_destination_register, 1, destination + 5);
+
+    return destination + (unsigned long long)BM0__ilt__receive_from_channel;
+}
+
+void* BM0__write_instruction__spawn(void* destination, unsigned char instruction_pointer_register, unsigned char thread_number_destination_register) {
+    unsigned short opcode = BM0__it__spawn;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&instruction_pointer_register, 1, destination + 2);
+    BM0__copy_bytes(&thread_number_destination_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__spawn;
+}
+
+void* BM0__write_instruction__join(void* destination, unsigned char thread_number_register, unsigned char output_pointer_destination_register) {
+    unsigned short opcode = BM0__it__join;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&thread_number_register, 1, destination + 2);
+    BM0__copy_bytes(&output_pointer_destination_register, 1, destination + 3);
+
+    return destination + (unsigned long long)BM0__ilt__join;
+}
+
+void* BM0__write_instruction__atomic_operate(void* destination, unsigned char atomic_operation, unsigned char pointer_register, unsigned char value_register, unsigned char expected_register, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__atomic_operate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&atomic_operation, 1, destination + 2);
+    BM0__copy_bytes(&pointer_register, 1, destination + 3);
+    BM0__copy_bytes(&value_register, 1, destination + 4);
+    BM0__copy_bytes(&expected_register, 1, destination + 5);
+    BM0__copy_bytes(&destination_register, 1, destination + 6);
+
+    return destination + (unsigned long long)BM0__ilt__atomic_operate;
+}
+
+void* BM0__write_instruction__allocate_with_policy(void* destination, unsigned char allocation_size_register, unsigned char policy_register, unsigned char handle_destination_register, unsigned char pointer_destination_register, unsigned char length_destination_register) {
+    unsigned short opcode = BM0__it__allocate_with_policy;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&allocation_size_register, 1, destination + 2);
+    BM0__copy_bytes(&policy_register, 1, destination + 3);
+    BM0__copy_bytes(&handle_destination_register, 1, destination + 4);
+    BM0__copy_bytes(&pointer_destination_register, 1, destination + 5);
+    BM0__copy_bytes(&length_destination_register, 1, destination + 6);
+
+    return destination + (unsigned long long)BM0__ilt__allocate_with_policy;
+}
+
+void* BM0__write_instruction__hash_table_operate(void* destination, unsigned char hash_table_operation, unsigned char handle_register, unsigned char key_register, unsigned char value_register, unsigned char destination_register) {
+    unsigned short opcode = BM0__it__hash_table_operate;
+
+    BM0__copy_bytes(&opcode, 2, destination);
+    BM0__copy_bytes(&hash_table_operation, 1, destination + 2);
+    BM0__copy_bytes(&handle_register, 1, destination + 3);
+    BM0__copy_bytes(&key_register, 1, destination + 4);
+    BM0__copy_bytes(&value_register, 1, destination + 5);
+    BM0__copy_bytes(&destination_register, 1, destination + 6);
+
+    return destination + (unsigned long long)BM0__ilt__hash_table_operate;
+}
+
+/* Assembler */
+// assembler section type
+typedef enum BM0__ast {
+    BM0__ast__code,
+    BM0__ast__rodata // placed after the code at an 8 byte boundary when the assembly is finished
+} BM0__ast;
+
+typedef struct BM0__assembler_label {
+    unsigned long long p_name_offset; // into the assembler's names
+    unsigned long long p_name_length;
+    unsigned long long p_hash;
+    unsigned long long p_offset; // inside its section
+    unsigned long long p_line; // where it was first used or placed, zero when not assembling text
+    BM0__ast p_section;
+    BM0__boolean p_placed;
+} BM0__assembler_label;
+
+// an 8 byte value in the code that becomes a label's offset in the finished program minus a base
+typedef struct BM0__assembler_fixup {
+    unsigned long long p_location;
+    unsigned long long p_label;
+    unsigned long long p_base;
+} BM0__assembler_fixup;
+
+// builds a program in growable sections, errors are sticky so a whole program can be assembled before checking
+typedef struct BM0__assembler {
+    BM0__buffer p_code;
+    unsigned long long p_code_length;
+    BM0__buffer p_rodata;
+    unsigned long long p_rodata_length;
+    BM0__buffer p_names;
+    unsigned long long p_names_length;
+    BM0__buffer p_labels; // BM0__assembler_label array
+    unsigned long long p_label_count;
+    BM0__buffer p_label_table; // label index + 1 per slot, zero when empty, a power of two slots
+    BM0__buffer p_fixups; // BM0__assembler_fixup array
+    unsigned long long p_fixup_count;
+    unsigned long long p_line; // line of text being assembled
+    unsigned long long p_error_line; // line of the first error, zero when not assembling text
+    unsigned char p_scratch[16]; // written to instead of the code after an error
+} BM0__assembler;
+
+BM0__assembler_label* BM0__get_assembler_labels(BM0__assembler* assembler) {
+    return (BM0__assembler_label*)(*assembler).p_labels.p_data;
+}
+
+BM0__assembler_fixup* BM0__get_assembler_fixups(BM0__assembler* assembler) {
+    return (BM0__assembler_fixup*)(*assembler).p_fixups.p_data;
+}
+
+unsigned long long* BM0__get_assembler_label_table(BM0__assembler* assembler) {
+    return (unsigned long long*)(*assembler).p_label_table.p_data;
+}
+
+void BM0__destroy_assembler(BM0__assembler assembler) {
+    BM0__destroy_buffer(assembler.p_code);
+    BM0__destroy_buffer(assembler.p_rodata);
+    BM0__destroy_buffer(assembler.p_names);
+    BM0__destroy_buffer(assembler.p_labels);
+    BM0__destroy_buffer(assembler.p_label_table);
+    BM0__destroy_buffer(assembler.p_fixups);
+
+    return;
+}
+
+BM0__assembler BM0__create_assembler(BM0__et* error) {
+    BM0__assembler output;
+
+    // setup sections and tables, they double whenever they run out
+    output.p_code = BM0__create_buffer(error, 65536);
+    output.p_code_length = 0;
+    output.p_rodata = BM0__create_buffer(error, 4096);
+    output.p_rodata_length = 0;
+    output.p_names = BM0__create_buffer(error, 4096);
+    output.p_names_length = 0;
+    output.p_labels = BM0__create_buffer(error, 64 * sizeof(BM0__assembler_label));
+    output.p_label_count = 0;
+    output.p_label_table = BM0__create_buffer(error, 128 * sizeof(unsigned long long));
+    output.p_fixups = BM0__create_buffer(error, 64 * sizeof(BM0__assembler_fixup));
+    output.p_fixup_count = 0;
+    output.p_line = 0;
+    output.p_error_line = 0;
+
+    return output;
+}
+
+// makes room for length more bytes after the used part of a buffer, returns false on failure
+BM0__boolean BM0__grow_assembler_buffer(BM0__et* error, BM0__buffer* buffer, unsigned long long used, unsigned long long length) {
+    BM0__buffer grown;
+    unsigned long long grown_length = (*buffer).p_length;
+
+    if (*error != BM0__et__no_error) {
+        return BM0__boolean__false;
+    }
+    if (used + length <= (*buffer).p_length) {
+        return BM0__boolean__true;
+    }
+
+    // double until it fits
+    while (grown_length < used + length) {
+        grown_length *= 2;
+    }
+    grown = BM0__create_buffer(error, grown_length);
+    if (*error != BM0__et__no_error) {
+        return BM0__boolean__false;
+    }
+    BM0__copy_bytes((*buffer).p_data, used, grown.p_data);
+    BM0__destroy_buffer(*buffer);
+    *buffer = grown;
+
+    return BM0__boolean__true;
+}
+
+// reports an assembly error at the current line unless an earlier error was already reported
+void BM0__report_assembly_error(BM0__et* error, BM0__assembler* assembler, BM0__et assembly_error, unsigned long long line) {
+    if (*error == BM0__et__no_error) {
+        *error = assembly_error;
+        (*assembler).p_error_line = line;
+    }
+
+    return;
+}
+
+// returns a pointer to length new bytes at the end of the code to write an instruction to, valid until the next call
+// after an error it returns scratch space that is thrown away when length fits in it (every instruction does) and zero otherwise, so instructions can be written without checking
+void* BM0__reserve_assembly(BM0__et* error, BM0__assembler* assembler, unsigned long long length) {
+    void* output;
+
+    if (BM0__grow_assembler_buffer(error, &(*assembler).p_code, (*assembler).p_code_length, length) == BM0__boolean__false) {
+        return length <= sizeof((*assembler).p_scratch) ? (*assembler).p_scratch : 0;
+    }
+
+    output = (*assembler).p_code.p_data + (*assembler).p_code_length;
+    (*assembler).p_code_length += length;
+
+    return output;
+}
+
+// writes any instruction from its parameters in BM0__write_instruction__N order, write_register's value is its second parameter
+void BM0__assemble_instruction(BM0__et* error, BM0__assembler* assembler, BM0__it opcode, unsigned long long* parameters) {
+    unsigned long long length = BM0__write_instruction__get_instruction_ilt(opcode);
+    unsigned short short_opcode = opcode;
+    void* destination;
+
+    if (length == 0) {
+        BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+        return;
+    }
+    destination = BM0__reserve_assembly(error, assembler, length);
+    if (*error != BM0__et__no_error) {
+        return;
+    }
+
+    // every parameter is one byte except write_register's value
+    BM0__copy_bytes(&short_opcode, 2, destination);
+    if (opcode == BM0__it__write_register) {
+        BM0__write_instruction__write_register(destination, (unsigned char)parameters[0], parameters[1]);
+    } else {
+        for (unsigned long long i = 0; i < length - 2; i++) {
+            *(unsigned char*)(destination + 2 + i) = (unsigned char)parameters[i];
+        }
+    }
+
+    return;
+}
+
+// returns the index of a label by name, adding it unplaced the first time it is used
+unsigned long long BM0__find_assembler_label(BM0__et* error, BM0__assembler* assembler, void* name, unsigned long long name_length) {
+    unsigned long long hash = BM0__hash_bytes(name, name_length);
+    unsigned long long slot_count = (*assembler).p_label_table.p_length / sizeof(unsigned long long);
+    unsigned long long slot = hash & (slot_count - 1);
+    BM0__assembler_label* label;
+    BM0__buffer table;
+
+    // look up name
+    while (BM0__get_assembler_label_table(assembler)[slot] != 0) {
+        label = &BM0__get_assembler_labels(assembler)[BM0__get_assembler_label_table(assembler)[slot] - 1];
+        if ((*label).p_hash == hash && (*label).p_name_length == name_length && BM0__compare_bytes((*assembler).p_names.p_data + (*label).p_name_offset, name, name_length) == name_length) {
+            return BM0__get_assembler_label_table(assembler)[slot] - 1;
+        }
+        slot = (slot + 1) & (slot_count - 1);
+    }
+
+    // add label
+    if (BM0__grow_assembler_buffer(error, &(*assembler).p_labels, (*assembler).p_label_count * sizeof(BM0__assembler_label), sizeof(BM0__assembler_label)) == BM0__boolean__false || BM0__grow_assembler_buffer(error, &(*assembler).p_names, (*assembler).p_names_length, name_length) == BM0__boolean__false) {
+        return 0;
+    }
+    label = &BM0__get_assembler_labels(assembler)[(*assembler).p_label_count];
+    (*label).p_name_offset = (*assembler).p_names_length;
+    (*label).p_name_length = name_length;
+    (*label).p_hash = hash;
+    (*label).p_offset = 0;
+    (*label).p_line = (*assembler).p_line;
+    (*label).p_section = BM0__ast__code;
+    (*label).p_placed = BM0__boolean__false;
+    BM0__copy_bytes(name, name_length, (*assembler).p_names.p_data + (*assembler).p_names_length);
+    (*assembler).p_names_length += name_length;
+    BM0__get_assembler_label_table(assembler)[slot] = (*assembler).p_label_count + 1;
+    (*assembler).p_label_count++;
+
+    // keep the table at most half full
+    if ((*assembler).p_label_count * 2 > slot_count) {
+        table = BM0__create_buffer(error, slot_count * 2 * sizeof(unsigned long long));
+        if (*error != BM0__et__no_error) {
+            return 0;
+        }
+        for (unsigned long long i = 0; i < (*assembler).p_label_count; i++) {
+            slot = BM0__get_assembler_labels(assembler)[i].p_hash & ((slot_count * 2) - 1);
+            while (((unsigned long long*)table.p_data)[slot] != 0) {
+                slot = (slot + 1) & ((slot_count * 2) - 1);
+            }
+            ((unsigned long long*)table.p_data)[slot] = i + 1;
+        }
+        BM0__destroy_buffer((*assembler).p_label_table);
+        (*assembler).p_label_table = table;
+    }
+
+    return (*assembler).p_label_count - 1;
+}
+
+// places a label at the current end of a section, a label can only be placed once
+void BM0__place_assembler_label_at(BM0__et* error, BM0__assembler* assembler, unsigned long long label_index, BM0__ast section) {
+    BM0__assembler_label* label;
+
+    if (*error != BM0__et__no_error) {
+        return;
+    }
+
+    label = &BM0__get_assembler_labels(assembler)[label_index];
+    if ((*label).p_placed) {
+        BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+        return;
+    }
+    (*label).p_placed = BM0__boolean__true;
+    (*label).p_section = section;
+    (*label).p_offset = section == BM0__ast__code ? (*assembler).p_code_length : (*assembler).p_rodata_length;
+    (*label).p_line = (*assembler).p_line;
+
+    return;
+}
+
+// writes a write_register instruction whose value is filled in with a label's offset minus a base when the assembly is finished
+void BM0__assemble_label_reference(BM0__et* error, BM0__assembler* assembler, unsigned char destination_register, unsigned long long label_index, unsigned long long base) {
+    BM0__assembler_fixup* fixup;
+    void* destination = BM0__reserve_assembly(error, assembler, BM0__ilt__write_register);
+
+    if (BM0__grow_assembler_buffer(error, &(*assembler).p_fixups, (*assembler).p_fixup_count * sizeof(BM0__assembler_fixup), sizeof(BM0__assembler_fixup)) == BM0__boolean__false) {
+        return;
+    }
+
+    BM0__write_instruction__write_register(destination, destination_register, 0);
+    fixup = &BM0__get_assembler_fixups(assembler)[(*assembler).p_fixup_count];
+    (*fixup).p_location = (*assembler).p_code_length - sizeof(unsigned long long);
+    (*fixup).p_label = label_index;
+    (*fixup).p_base = base;
+    (*assembler).p_fixup_count++;
+
+    return;
+}
+
+// writes a jump to a label, taken when the operate instruction's required flag bit is set in the flags register or always, distance_register is overwritten
+void BM0__assemble_jump_to_label(BM0__et* error, BM0__assembler* assembler, unsigned char flags_register_number, unsigned char required_flag_bit, unsigned char distance_register, unsigned long long label_index) {
+    // the operate instruction adds its own length after the jump, so the distance is from the end of it
+    BM0__assemble_label_reference(error, assembler, distance_register, label_index, (*assembler).p_code_length + BM0__ilt__write_register + BM0__ilt__operate);
+    BM0__write_instruction__operate(BM0__reserve_assembly(error, assembler, BM0__ilt__operate), flags_register_number, required_flag_bit, BM0__ot__integer__add, BM0__rt__instruction_pointer_register, distance_register, BM0__rt__instruction_pointer_register);
+
+    return;
+}
+
+// adds data to the rodata section under a label
+void BM0__assemble_data_at_label(BM0__et* error, BM0__assembler* assembler, unsigned long long label_index, void* data, unsigned long long length) {
+    unsigned long long padding = (sizeof(unsigned long long) - ((*assembler).p_rodata_length % sizeof(unsigned long long))) % sizeof(unsigned long long);
+
+    // every piece of data starts at an 8 byte boundary
+    if (BM0__grow_assembler_buffer(error, &(*assembler).p_rodata, (*assembler).p_rodata_length, padding + length) == BM0__boolean__false) {
+        return;
+    }
+    (*assembler).p_rodata_length += padding;
+    BM0__place_assembler_label_at(error, assembler, label_index, BM0__ast__rodata);
+    BM0__copy_bytes(data, length, (*assembler).p_rodata.p_data + (*assembler).p_rodata_length);
+    (*assembler).p_rodata_length += length;
+
+    return;
+}
+
+// places a code label at the current end of the code
+void BM0__place_assembler_label(BM0__et* error, BM0__assembler* assembler, char* name) {
+    unsigned long long label_index = BM0__find_assembler_label(error, assembler, name, BM0__null_terminated_string_length_without_null(name));
+
+    BM0__place_assembler_label_at(error, assembler, label_index, BM0__ast__code);
+
+    return;
+}
+
+// writes the label's offset in the finished program to a register, add input buffer 0's address to get a pointer
+void BM0__assemble_label_offset(BM0__et* error, BM0__assembler* assembler, unsigned char destination_register, char* label) {
+    BM0__assemble_label_reference(error, assembler, destination_register, BM0__find_assembler_label(error, assembler, label, BM0__null_terminated_string_length_without_null(label)), 0);
+
+    return;
+}
+
+void BM0__assemble_jump(BM0__et* error, BM0__assembler* assembler, unsigned char flags_register_number, unsigned char required_flag_bit, unsigned char distance_register, char* label) {
+    BM0__assemble_jump_to_label(error, assembler, flags_register_number, required_flag_bit, distance_register, BM0__find_assembler_label(error, assembler, label, BM0__null_terminated_string_length_without_null(label)));
+
+    return;
+}
+
+void BM0__assemble_data(BM0__et* error, BM0__assembler* assembler, char* label, BM0__buffer data) {
+    BM0__assemble_data_at_label(error, assembler, BM0__find_assembler_label(error, assembler, label, BM0__null_terminated_string_length_without_null(label)), data.p_data, data.p_length);
+
+    return;
+}
+
+// lays the rodata out after the code and fills in every label reference, returns the finished program which the caller owns
+BM0__buffer BM0__finish_assembly(BM0__et* error, BM0__assembler* assembler) {
+    BM0__buffer output = BM0__create_null_buffer();
+    unsigned long long rodata_offset = ((*assembler).p_code_length + sizeof(unsigned long long) - 1) & ~(sizeof(unsigned long long) - 1);
+    BM0__assembler_fixup* fixup;
+    BM0__assembler_label* label;
+    unsigned long long value;
+
+    if (*error != BM0__et__no_error) {
+        return output;
+    }
+
+    // every referenced label must be placed
+    for (unsigned long long i = 0; i < (*assembler).p_fixup_count; i++) {
+        label = &BM0__get_assembler_labels(assembler)[BM0__get_assembler_fixups(assembler)[i].p_label];
+        if ((*label).p_placed == BM0__boolean__false) {
+            BM0__report_assembly_error(error, assembler, BM0__et__undefined_assembler_label, (*label).p_line);
+
+            return output;
+        }
+    }
+
+    // join sections
+    output = BM0__create_buffer(error, rodata_offset + (*assembler).p_rodata_length);
+    if (*error != BM0__et__no_error) {
+        return output;
+    }
+    BM0__copy_bytes((*assembler).p_code.p_data, (*assembler).p_code_length, output.p_data);
+    BM0__copy_bytes((*assembler).p_rodata.p_data, (*assembler).p_rodata_length, output.p_data + rodata_offset);
+
+    // fill in references
+    for (unsigned long long i = 0; i < (*assembler).p_fixup_count; i++) {
+        fixup = &BM0__get_assembler_fixups(assembler)[i];
+        label = &BM0__get_assembler_labels(assembler)[(*fixup).p_label];
+        value = (*label).p_offset + ((*label).p_section == BM0__ast__rodata ? rodata_offset : 0) - (*fixup).p_base;
+        BM0__copy_bytes(&value, sizeof(unsigned long long), output.p_data + (*fixup).p_location);
+    }
+
+    return output;
+}
+
+/* Assembler - Text */
+// one space separated word of a line
+typedef struct BM0__assembler_token {
+    char* p_data;
+    unsigned long long p_length;
+} BM0__assembler_token;
+
+BM0__boolean BM0__check_assembler_token(BM0__assembler_token token, char* word) {
+    unsigned long long length = BM0__null_terminated_string_length_without_null(word);
+
+    return (BM0__boolean)(token.p_length == length && BM0__compare_bytes(token.p_data, word, length) == length);
+}
+
+// reads a decimal or 0x prefixed hexadecimal number, returns false if the token is not one
+BM0__boolean BM0__read_assembler_number(BM0__assembler_token token, unsigned long long* value) {
+    unsigned long long base = 10;
+    unsigned long long i = 0;
+    unsigned long long digit;
+
+    if (token.p_length > 2 && token.p_data[0] == '0' && (token.p_data[1] == 'x' || token.p_data[1] == 'X')) {
+        base = 16;
+        i = 2;
+    }
+    if (token.p_length == i) {
+        return BM0__boolean__false;
+    }
+
+    *value = 0;
+    for (; i < token.p_length; i++) {
+        if (token.p_data[i] >= '0' && token.p_data[i] <= '9') {
+            digit = (unsigned long long)(token.p_data[i] - '0');
+        } else if (base == 16 && token.p_data[i] >= 'a' && token.p_data[i] <= 'f') {
+            digit = (unsigned long long)(token.p_data[i] - 'a') + 10;
+        } else if (base == 16 && token.p_data[i] >= 'A' && token.p_data[i] <= 'F') {
+            digit = (unsigned long long)(token.p_data[i] - 'A') + 10;
+        } else {
+            return BM0__boolean__false;
+        }
+        if (digit >= base) {
+            return BM0__boolean__false;
+        }
+
+        // numbers that do not fit in 64 bits are rejected instead of wrapping into a different one
+        if (__builtin_mul_overflow(*value, base, value) || __builtin_add_overflow(*value, digit, value)) {
+            return BM0__boolean__false;
+        }
+    }
+
+    return BM0__boolean__true;
+}
+
+// reads an instruction parameter, operate's operation, the syscall number and the atomic and hash table operations can also be given by name
+BM0__boolean BM0__read_assembler_parameter(BM0__assembler_token token, BM0__it opcode, unsigned long long parameter_index, unsigned long long* value) {
+    if (BM0__read_assembler_number(token, value)) {
+        return (BM0__boolean)(*value <= 255 || (opcode == BM0__it__write_register && parameter_index == 1));
+    }
+
+    // names
+    for (unsigned long long i = 0; opcode == BM0__it__operate && parameter_index == 2 && i <= BM0__ot__comparison__greater_than; i++) {
+        if (BM0__check_assembler_token(token, BM0__get_operation_name(i))) {
+            *value = i;
+
+            return BM0__boolean__true;
+        }
+    }
+    for (unsigned long long i = 0; opcode == BM0__it__do_x86_64_linux_syscall_limited && parameter_index == 0 && i <= BM0__st__futex_wake; i++) {
+        if (BM0__check_assembler_token(token, BM0__get_syscall_name(i))) {
+            *value = i;
+
+            return BM0__boolean__true;
+        }
+    }
+    for (unsigned long long i = 0; opcode == BM0__it__atomic_operate && parameter_index == 0 && i <= BM0__aot__fence; i++) {
+        if (BM0__check_assembler_token(token, BM0__get_atomic_operation_name(i))) {
+            *value = i;
+
+            return BM0__boolean__true;
+        }
+    }
+    for (unsigned long long i = 0; opcode == BM0__it__hash_table_operate && parameter_index == 0 && i <= BM0__hot__clear; i++) {
+        if (BM0__check_assembler_token(token, BM0__get_hash_table_operation_name(i))) {
+            *value = i;
+
+            return BM0__boolean__true;
+        }
+    }
+
+    return BM0__boolean__false;
+}
+
+// reads a double quoted string with \n, \t, \0 and \xHH escapes (any other escaped character stands for itself), returns false if it is not one
+BM0__boolean BM0__read_assembler_string(BM0__et* error, BM0__assembler* assembler, BM0__assembler_token token, BM0__buffer* string) {
+    unsigned long long start = (*assembler).p_names_length;
+    unsigned long long i = 1;
+    char hex[4] = { '0', 'x', 0, 0 };
+    unsigned long long value;
+    char character;
+
+    if (token.p_length < 2 || token.p_data[0] != '"' || token.p_data[token.p_length - 1] != '"') {
+        return BM0__boolean__false;
+    }
+
+    // the bytes are kept after the label names until the data is copied
+    while (i < token.p_length - 1) {
+        character = token.p_data[i];
+        if (character == '\\') {
+            if (i + 1 >= token.p_length - 1) {
+                return BM0__boolean__false;
+            }
+            i++;
+            character = token.p_data[i];
+            if (character == 'n') {
+                character = '\n';
+            } else if (character == 't') {
+                character = '\t';
+            } else if (character == '0') {
+                character = 0;
+            } else if (character == 'x') {
+                if (i + 2 >= token.p_length - 1) {
+                    return BM0__boolean__false;
+                }
+                hex[2] = token.p_data[i + 1];
+                hex[3] = token.p_data[i + 2];
+                if (BM0__read_assembler_number((BM0__assembler_token){ hex, 4 }, &value) == BM0__boolean__false) {
+                    return BM0__boolean__false;
+                }
+                character = (char)value;
+                i += 2;
+            }
+        } else if (character == '"') {
+            return BM0__boolean__false;
+        }
+        if (BM0__grow_assembler_buffer(error, &(*assembler).p_names, (*assembler).p_names_length, 1) == BM0__boolean__false) {
+            return BM0__boolean__false;
+        }
+        *(char*)((*assembler).p_names.p_data + (*assembler).p_names_length) = character;
+        (*assembler).p_names_length++;
+        i++;
+    }
+
+    (*string).p_data = (*assembler).p_names.p_data + start;
+    (*string).p_length = (*assembler).p_names_length - start;
+
+    return BM0__boolean__true;
+}
+
+// splits a line into at most max_tokens words separated by spaces, tabs or commas, a quoted string is one word, returns the token count or max_tokens + 1 if there are more
+unsigned long long BM0__split_assembler_line(char* line, unsigned long long length, BM0__assembler_token* tokens, unsigned long long max_tokens) {
+    unsigned long long output = 0;
+    unsigned long long i = 0;
+    unsigned long long start;
+
+    while (i < length) {
+        // skip separators
+        if (line[i] == ' ' || line[i] == '\t' || line[i] == ',' || line[i] == '\r') {
+            i++;
+
+            continue;
+        }
+
+        // comment
+        if (line[i] == '#') {
+            break;
+        }
+
+        // word
+        start = i;
+        if (line[i] == '"') {
+            i++;
+            while (i < length && line[i] != '"') {
+                i += (line[i] == '\\' && i + 1 < length) ? 2 : 1;
+            }
+            i = i < length ? i + 1 : length;
+        } else {
+            while (i < length && line[i] != ' ' && line[i] != '\t' && line[i] != ',' && line[i] != '\r' && line[i] != '#') {
+                i++;
+            }
+        }
+        if (output == max_tokens) {
+            return max_tokens + 1;
+        }
+        tokens[output].p_data = line + start;
+        tokens[output].p_length = i - start;
+        output++;
+    }
+
+    return output;
+}
+
+// assembles one line of text
+void BM0__assemble_line(BM0__et* error, BM0__assembler* assembler, char* line, unsigned long long length) {
+    BM0__assembler_token tokens[12];
+    unsigned long long token_count = BM0__split_assembler_line(line, length, tokens, 12);
+    BM0__assembler_token* token = tokens;
+    unsigned long long parameters[8];
+    unsigned long long parameter_count;
+    BM0__buffer string;
+    unsigned long long scratch_length;
+
+    if (token_count > 12) {
+        BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+        return;
+    }
+
+    // label definition
+    if (token_count > 0 && (*token).p_length > 1 && (*token).p_data[(*token).p_length - 1] == ':') {
+        BM0__place_assembler_label_at(error, assembler, BM0__find_assembler_label(error, assembler, (*token).p_data, (*token).p_length - 1), BM0__ast__code);
+        token++;
+        token_count--;
+    }
+    if (token_count == 0 || *error != BM0__et__no_error) {
+        return;
+    }
+
+    // jump flags_register required_flag_bit distance_register label
+    if (BM0__check_assembler_token(*token, "jump")) {
+        if (token_count != 5 || BM0__read_assembler_parameter(token[1], BM0__it__quit, 0, &parameters[0]) == BM0__boolean__false || BM0__read_assembler_parameter(token[2], BM0__it__quit, 0, &parameters[1]) == BM0__boolean__false || BM0__read_assembler_parameter(token[3], BM0__it__quit, 0, &parameters[2]) == BM0__boolean__false) {
+            BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+            return;
+        }
+        BM0__assemble_jump_to_label(error, assembler, (unsigned char)parameters[0], (unsigned char)parameters[1], (unsigned char)parameters[2], BM0__find_assembler_label(error, assembler, token[4].p_data, token[4].p_length));
+
+        return;
+    }
+
+    // offset destination_register label
+    if (BM0__check_assembler_token(*token, "offset")) {
+        if (token_count != 3 || BM0__read_assembler_parameter(token[1], BM0__it__quit, 0, &parameters[0]) == BM0__boolean__false) {
+            BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+            return;
+        }
+        BM0__assemble_label_reference(error, assembler, (unsigned char)parameters[0], BM0__find_assembler_label(error, assembler, token[2].p_data, token[2].p_length), 0);
+
+        return;
+    }
+
+    // data label "string"
+    if (BM0__check_assembler_token(*token, "data")) {
+        if (token_count != 3) {
+            BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+            return;
+        }
+        parameters[0] = BM0__find_assembler_label(error, assembler, token[1].p_data, token[1].p_length);
+        scratch_length = (*assembler).p_names_length;
+        if (*error != BM0__et__no_error || BM0__read_assembler_string(error, assembler, token[2], &string) == BM0__boolean__false) {
+            BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+            return;
+        }
+        BM0__assemble_data_at_label(error, assembler, parameters[0], string.p_data, string.p_length);
+        (*assembler).p_names_length = scratch_length;
+
+        return;
+    }
+
+    // instruction
+    for (unsigned long long opcode = BM0__it__quit; opcode <= BM0__it__hash_table_operate; opcode++) {
+        if (BM0__check_assembler_token(*token, BM0__get_instruction_name(opcode))) {
+            parameter_count = opcode == BM0__it__write_register ? 2 : BM0__write_instruction__get_instruction_ilt((BM0__it)opcode) - 2;
+            if (token_count != parameter_count + 1) {
+                BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+                return;
+            }
+            for (unsigned long long i = 0; i < parameter_count; i++) {
+                if (BM0__read_assembler_parameter(token[i + 1], (BM0__it)opcode, i, &parameters[i]) == BM0__boolean__false) {
+                    BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+                    return;
+                }
+            }
+            BM0__assemble_instruction(error, assembler, (BM0__it)opcode, parameters);
+
+            return;
+        }
+    }
+
+    BM0__report_assembly_error(error, assembler, BM0__et__invalid_assembly, (*assembler).p_line);
+
+    return;
+}
+
+// assembles a whole text into a finished program, on an error the line it happened on is written to error_line
+BM0__buffer BM0__assemble_text(BM0__et* error, BM0__buffer text, unsigned long long* error_line) {
+    BM0__assembler assembler = BM0__create_assembler(error);
+    BM0__buffer output = BM0__create_null_buffer();
+    unsigned long long line_start = 0;
+    unsigned long long line_end;
+
+    // one line at a time
+    while (*error == BM0__et__no_error && line_start < text.p_length) {
+        line_end = line_start;
+        while (line_end < text.p_length && *(char*)(text.p_data + line_end) != '\n') {
+            line_end++;
+        }
+        assembler.p_line++;
+        BM0__assemble_line(error, &assembler, (char*)(text.p_data + line_start), line_end - line_start);
+        line_start = line_end + 1;
+    }
+
+    output = BM0__finish_assembly(error, &assembler);
+    *error_line = assembler.p_error_line;
+    BM0__destroy_assembler(assembler);
+
+    return output;
+}
+
+/* Trace */
+#ifdef BM0__enable__trace
+// one instruction that ran, 32 bytes
+typedef struct BM0__trace_entry {
+    unsigned int p_offset; // of the instruction in input buffer 0, all bits set when it ran from anywhere else
+    unsigned char p_instruction[BM0__define__max_instruction_length]; // as it was encoded when it ran, followed by whatever came after it
+    unsigned char p_destination_register; // the instruction pointer register for instructions that write no register
+    unsigned long long p_value; // the destination register after the instruction ran, the instruction pointer is kept as an offset into input buffer 0
+    unsigned long long p_error; // the register the error code register points to after the instruction ran
+} BM0__trace_entry;
+
+// a ring of the last instructions a context ran, only the context's thread writes to it and any thread can copy it
+typedef struct BM0__trace {
+    BM0__trace_entry* p_entries;
+    unsigned long long p_entry_count; // always a power of two
+    unsigned long long p_head; // how many entries have been finished, the next one goes at p_head modulo p_entry_count
+    BM0__boolean p_recording; // the entry at p_head has been started and is finished once the next instruction starts
+    BM0__buffer p_program; // input buffer 0 of the current run, not owned by the trace
+    FILE* p_error_file; // where the trace is printed when a run ends in an error, zero to never print it
+} BM0__trace;
+
+// the entry count is rounded up to a power of two of at least 2, one entry is always the one being written
+BM0__trace* BM0__create_trace(BM0__et* error, unsigned long long entry_count, FILE* error_file) {
+    unsigned long long rounded_entry_count = 2;
+    BM0__trace* trace;
+
+    while (rounded_entry_count < entry_count) {
+        rounded_entry_count <<= 1;
+    }
+    trace = (BM0__trace*)BM0__allocate(sizeof(BM0__trace) + (sizeof(BM0__trace_entry) * rounded_entry_count));
+    if (trace == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    (*trace).p_entries = (BM0__trace_entry*)(trace + 1);
+    (*trace).p_entry_count = rounded_entry_count;
+    (*trace).p_head = 0;
+    (*trace).p_recording = BM0__boolean__false;
+    (*trace).p_program = BM0__create_null_buffer();
+    (*trace).p_error_file = error_file;
+    *error = BM0__et__no_error;
+
+    return trace;
+}
+
+void BM0__destroy_trace(BM0__trace* trace) {
+    BM0__deallocate(trace, sizeof(BM0__trace) + (sizeof(BM0__trace_entry) * (*trace).p_entry_count));
+
+    return;
+}
+
+// the register an encoded instruction writes its result to, instructions without one report the instruction pointer
+unsigned char BM0__get_instruction_destination_register(unsigned char* instruction) {
+    // the byte holding the destination register per instruction, zero for none
+    static unsigned char destination_parameters[] = { 0, 2, 3, 0, 4, 3, 0, 7, 9, 0, 0, 5, 0, 0, 0, 0, 5, 4, 5, 4, 3, 3, 3, 6, 4, 6 };
+    unsigned short opcode = instruction[0] | ((unsigned short)instruction[1] << 8);
+
+    if (opcode >= sizeof(destination_parameters) || destination_parameters[opcode] == 0) {
+        return BM0__rt__instruction_pointer_register;
+    }
+
+    return instruction[destination_parameters[opcode]];
+}
+
+// finishes the entry of the instruction that ran last and publishes it to readers
+void BM0__finish_tracing_instruction(BM0__trace* trace, void** regs) {
+    BM0__trace_entry* entry = &(*trace).p_entries[(*trace).p_head & ((*trace).p_entry_count - 1)];
+
+    if ((*trace).p_recording == BM0__boolean__false) {
+        return;
+    }
+
+    (*entry).p_value = (unsigned long long)regs[(*entry).p_destination_register];
+    if ((*entry).p_destination_register == BM0__rt__instruction_pointer_register) {
+        (*entry).p_value -= (unsigned long long)(*trace).p_program.p_data;
+    }
+    (*entry).p_error = (unsigned long long)regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]];
+    __atomic_store_n(&(*trace).p_head, (*trace).p_head + 1, __ATOMIC_RELEASE);
+    (*trace).p_recording = BM0__boolean__false;
+
+    return;
+}
+
+// copies an instruction near the end of the program or outside of it, reading only the instruction's own bytes
+void BM0__copy_traced_instruction(BM0__trace_entry* entry, unsigned char* instruction_pointer) {
+    unsigned short opcode = 0;
+    unsigned long long length;
+
+    BM0__copy_bytes(instruction_pointer, 2, &opcode);
+    length = BM0__write_instruction__get_instruction_ilt((BM0__it)opcode);
+    if (length < 2) {
+        length = 2;
+    }
+    BM0__zero_bytes((*entry).p_instruction, BM0__define__max_instruction_length);
+    BM0__copy_bytes(instruction_pointer, length, (*entry).p_instruction);
+
+    return;
+}
+
+// records the instruction at the instruction pointer, called right before it runs
+// kept small so compilers inline it into the engines, most instructions only cost a few loads and stores
+void BM0__trace_instruction(BM0__trace* trace, void** regs) {
+    unsigned char* instruction_pointer = (unsigned char*)regs[BM0__rt__instruction_pointer_register];
+    unsigned long long offset = (unsigned long long)(instruction_pointer - (unsigned char*)(*trace).p_program.p_data);
+    BM0__trace_entry* entry;
+
+    BM0__finish_tracing_instruction(trace, regs);
+    entry = &(*trace).p_entries[(*trace).p_head & ((*trace).p_entry_count - 1)];
+    if (offset + BM0__define__max_instruction_length <= (*trace).p_program.p_length) {
+        __builtin_memcpy((*entry).p_instruction, instruction_pointer, BM0__define__max_instruction_length);
+        (*entry).p_offset = offset < 0xFFFFFFFF ? (unsigned int)offset : 0xFFFFFFFF;
+    } else {
+        BM0__copy_traced_instruction(entry, instruction_pointer);
+        (*entry).p_offset = offset < (*trace).p_program.p_length ? (unsigned int)offset : 0xFFFFFFFF;
+    }
+    (*entry).p_destination_register = BM0__get_instruction_destination_register(instruction_pointer);
+    (*trace).p_recording = BM0__boolean__true;
+
+    return;
+}
+
+// copies up to maximum_count of the newest finished entries, oldest first, and returns how many were copied
+// safe to call from any thread while the trace is being written, entries overwritten during the copy are left out
+unsigned long long BM0__copy_trace(BM0__trace* trace, BM0__trace_entry* entries, unsigned long long maximum_count) {
+    unsigned long long head = __atomic_load_n(&(*trace).p_head, __ATOMIC_ACQUIRE);
+    unsigned long long first;
+    unsigned long long overwritten;
+    unsigned long long count;
+
+    // the oldest slot is the one the writer starts next, so it is never copied
+    count = head < (*trace).p_entry_count - 1 ? head : (*trace).p_entry_count - 1;
+    if (count > maximum_count) {
+        count = maximum_count;
+    }
+    first = head - count;
+    for (unsigned long long i = 0; i < count; i++) {
+        entries[i] = (*trace).p_entries[(first + i) & ((*trace).p_entry_count - 1)];
+    }
+
+    // drop whatever the writer reached while copying
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    head = __atomic_load_n(&(*trace).p_head, __ATOMIC_ACQUIRE);
+    overwritten = head + 1 > first + (*trace).p_entry_count ? head + 1 - (first + (*trace).p_entry_count) : 0;
+    if (overwritten >= count) {
+        return 0;
+    }
+    if (overwritten > 0) {
+        BM0__copy_bytes(&entries[overwritten], sizeof(BM0__trace_entry) * (count - overwritten), entries);
+    }
+
+    return count - overwritten;
+}
+
+// parameter names in the order the BM0__write_instruction__N functions write them, every parameter is one byte except the value of write_register
+char** BM0__get_instruction_parameter_names(unsigned long long instruction) {
+    static char* names[][BM0__define__max_parameter_count + 1] = {
+        { "buffer_pointer_source_register", "buffer_length_source_register", 0 },
+        { "destination_register", "value", 0 },
+        { "allocation_size_register", "handle_destination_register", "pointer_destination_register", "length_destination_register", 0 },
+        { "handle_register", 0 },
+        { "source_pointer_register", "byte_count", "destination_register", 0 },
+        { "source_register", "destination_register", 0 },
+        { "source_register", "byte_count", "destination_pointer_register", 0 },
+        { "flags_register_number", "required_flag_bit", "operation", "source_register_1", "source_register_2", "destination_register_1", 0 },
+        { "syscall_number", "argument_1", "argument_2", "argument_3", "argument_4", "argument_5", "argument_6", "return_value_destination_register", 0 },
+        { "source_pointer_register", "byte_count_register", "destination_pointer_register", 0 },
+        { "value_register", "byte_count_register", "destination_pointer_register", 0 },
+        { "pointer_register_1", "pointer_register_2", "byte_count_register", "destination_register", 0 },
+        { "source_pointer_register", "destination_vector_register", 0 },
+        { "source_vector_register", "destination_pointer_register", 0 },
+        { "lane_type", "source_register", "destination_vector_register", 0 },
+        { "flags_register_number", "required_flag_bit", "operation", "lane_type", "source_vector_register_1", "source_vector_register_2", "destination_vector_register", 0 },
+        { "reduction", "lane_type", "source_vector_register", "destination_register", 0 },
+        { "requests_pointer_register", "request_count_register", "submitted_count_destination_register", 0 },
+        { "completions_pointer_register", "maximum_count_register", "minimum_count_register", "completed_count_destination_register", 0 },
+        { "channel_number_register", "handle_register", "sent_destination_register", 0 },
+        { "channel_number_register", "handle_destination_register", "pointer_destination_register", "length_destination_register", 0 },
+        { "instruction_pointer_register", "thread_number_destination_register", 0 },
+        { "thread_number_register", "output_pointer_destination_register", 0 },
+        { "atomic_operation", "pointer_register", "value_register", "expected_register", "destination_register", 0 },
+        { "allocation_size_register", "policy_register", "handle_destination_register", "pointer_destination_register", "length_destination_register", 0 },
+        { "hash_table_operation", "handle_register", "key_register", "value_register", "destination_register", 0 }
+    };
+    static char* no_names[] = { 0 };
+
+    if (instruction >= sizeof(names) / sizeof(names[0])) {
+        return no_names;
+    }
+
+    return names[instruction];
+}
+
+// one line per entry: the offset, the instruction with its parameters, the destination register's new value and the error code
+void BM0__print_trace_entry(BM0__trace_entry* entry, FILE* file) {
+    unsigned short opcode = (*entry).p_instruction[0] | ((unsigned short)(*entry).p_instruction[1] << 8);
+    char** names = BM0__get_instruction_parameter_names(opcode);
+    unsigned char* parameter = (*entry).p_instruction + 2;
+    unsigned long long value;
+
+    if ((*entry).p_offset == 0xFFFFFFFF) {
+        fprintf(file, "outside_program\t%s", BM0__get_instruction_name(opcode));
+    } else {
+        fprintf(file, "%u\t%s", (*entry).p_offset, BM0__get_instruction_name(opcode));
+    }
+    for (unsigned long long i = 0; names[i] != 0; i++) {
+        value = *parameter;
+        if (opcode == BM0__it__write_register && i == 1) {
+            BM0__copy_bytes(parameter, sizeof(unsigned long long), &value);
+            parameter += sizeof(unsigned long long) - 1;
+        }
+        parameter++;
+
+        // operations inside the instruction and syscalls are named
+        if (opcode == BM0__it__do_x86_64_linux_syscall_limited && i == 0) {
+            fprintf(file, " %s=%s", names[i], BM0__get_syscall_name(value));
+        } else if (opcode == BM0__it__atomic_operate && i == 0) {
+            fprintf(file, " %s=%s", names[i], BM0__get_atomic_operation_name(value));
+        } else if (opcode == BM0__it__hash_table_operate && i == 0) {
+            fprintf(file, " %s=%s", names[i], BM0__get_hash_table_operation_name(value));
+        } else if ((opcode == BM0__it__operate || opcode == BM0__it__vector_operate) && i == 2 && (BM0__get_operate_mode((*entry).p_instruction[3]) == BM0__omt__flag_bit__direct_operation || BM0__get_operate_mode((*entry).p_instruction[3]) == BM0__omt__always__direct_operation)) {
+            fprintf(file, " %s=%s", names[i], opcode == BM0__it__vector_operate ? BM0__get_vector_operation_name(value) : BM0__get_operation_name(value));
+        } else {
+            fprintf(file, " %s=%llu", names[i], value);
+        }
+    }
+    if ((*entry).p_destination_register == BM0__rt__instruction_pointer_register) {
+        fprintf(file, "\tnext_offset=%llu\terror=%llu\n", (*entry).p_value, (*entry).p_error);
+    } else {
+        fprintf(file, "\tregister_%u=%llu\terror=%llu\n", (unsigned int)(*entry).p_destination_register, (*entry).p_value, (*entry).p_error);
+    }
+
+    return;
+}
+
+// prints the finished entries oldest first, safe to call from any thread while the trace is being written
+void BM0__print_trace(BM0__trace* trace, FILE* file) {
+    BM0__trace_entry* entries = (BM0__trace_entry*)BM0__allocate(sizeof(BM0__trace_entry) * (*trace).p_entry_count);
+    unsigned long long count;
+
+    if (entries == 0) {
+        return;
+    }
+
+    count = BM0__copy_trace(trace, entries, (*trace).p_entry_count);
+    fprintf(file, "offset\tinstruction\tdestination\terror\n");
+    for (unsigned long long i = 0; i < count; i++) {
+        BM0__print_trace_entry(&entries[i], file);
+    }
+    BM0__deallocate(entries, sizeof(BM0__trace_entry) * (*trace).p_entry_count);
+
+    return;
+}
+#endif
+
+/* Verification */
+// checks one instruction's encoded bytes the way the reference engine would when running it, operations read from registers are only known while running
+BM0__et BM0__verify_instruction(unsigned char* instruction) {
+    unsigned short opcode = 0;
+    unsigned char* parameters = instruction + 2;
+
+    BM0__copy_bytes(instruction, 2, &opcode);
+    switch ((BM0__it)opcode) {
+    case BM0__it__buffer_to_register:
+    case BM0__it__register_to_buffer:
+        if (parameters[1] > sizeof(unsigned long long)) {
+            return BM0__et__invalid_byte_transfer_size;
+        }
+
+        break;
+    case BM0__it__operate:
+        if ((BM0__get_operate_mode(parameters[1]) == BM0__omt__flag_bit__direct_operation || BM0__get_operate_mode(parameters[1]) == BM0__omt__always__direct_operation) && parameters[2] > BM0__ot__comparison__greater_than) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    case BM0__it__do_x86_64_linux_syscall_limited:
+        if (parameters[0] > BM0__st__futex_wake) {
+            return BM0__et__unimplemented_syscall;
+        }
+
+        break;
+    case BM0__it__register_to_vector:
+        if (parameters[0] > BM0__vlt__64_bit) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    case BM0__it__vector_operate:
+        if (parameters[3] > BM0__vlt__64_bit || ((BM0__get_operate_mode(parameters[1]) == BM0__omt__flag_bit__direct_operation || BM0__get_operate_mode(parameters[1]) == BM0__omt__always__direct_operation) && parameters[2] > BM0__vot__comparison__greater_than)) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    case BM0__it__reduce_vector:
+        if (parameters[0] > BM0__vrt__first_nonzero || parameters[1] > BM0__vlt__64_bit) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    case BM0__it__atomic_operate:
+        if (parameters[0] > BM0__aot__fence) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    case BM0__it__hash_table_operate:
+        if (parameters[0] > BM0__hot__clear) {
+            return BM0__et__unimplemented_operation;
+        }
+
+        break;
+    default:
+        break;
+    }
+
+    return BM0__et__no_error;
+}
+
+// checks if running an instruction can leave the instruction pointer right after it
+BM0__boolean BM0__check_instruction_falls_through(unsigned char* instruction) {
+    unsigned short opcode = 0;
+    unsigned char* parameters = instruction + 2;
+
+    BM0__copy_bytes(instruction, 2, &opcode);
+    switch ((BM0__it)opcode) {
+    case BM0__it__quit:
+        return BM0__boolean__false;
+    case BM0__it__write_register:
+        return (BM0__boolean)(parameters[0] != BM0__rt__instruction_pointer_register);
+    case BM0__it__register_to_register:
+        return (BM0__boolean)(parameters[1] != BM0__rt__instruction_pointer_register);
+    case BM0__it__buffer_to_register:
+        return (BM0__boolean)(parameters[2] != BM0__rt__instruction_pointer_register || parameters[1] != sizeof(unsigned long long));
+    case BM0__it__operate:
+        return (BM0__boolean)(parameters[5] != BM0__rt__instruction_pointer_register || BM0__get_operate_mode(parameters[1]) < BM0__omt__always__direct_operation);
+    default:
+        return BM0__boolean__true;
+    }
+}
+
+// walks the first code_length bytes of a program once, they must be valid instructions back to back and the last one must not fall through past them
+// the rest of the program is treated as data, returns the offset of the first problem found or code_length when there was none
+// jump targets are only known while running, so a verified program can still jump into its data or into the middle of an instruction
+unsigned long long BM0__verify_program(BM0__et* error, BM0__buffer code, unsigned long long code_length) {
+    unsigned char instruction[BM0__define__max_instruction_length];
+    unsigned long long offset = 0;
+    unsigned long long last_offset = 0;
+    unsigned long long length;
+    unsigned short opcode;
+
+    // check code length
+    if (code.p_data == 0 || code_length > code.p_length) {
+        *error = BM0__et__invalid_input_buffer;
+
+        return 0;
+    }
+
+    // check instructions
+    while (offset < code_length) {
+        opcode = 0;
+        if (offset + 2 > code_length) {
+            *error = BM0__et__program_runs_past_end;
+
+            return offset;
+        }
+        BM0__copy_bytes(code.p_data + offset, 2, &opcode);
+        length = BM0__write_instruction__get_instruction_ilt((BM0__it)opcode);
+        if (length == 0) {
+            *error = BM0__et__unimplemented_instruction_ID;
+
+            return offset;
+        }
+        if (offset + length > code_length) {
+            *error = BM0__et__program_runs_past_end;
+
+            return offset;
+        }
+
+        BM0__copy_bytes(code.p_data + offset, length, instruction);
+        *error = BM0__verify_instruction(instruction);
+        if (*error != BM0__et__no_error) {
+            return offset;
+        }
+
+        last_offset = offset;
+        offset += length;
+    }
+
+    // the instruction pointer must never walk off the end of the code, even an empty program runs its first instruction
+    if (code_length == 0 || BM0__check_instruction_falls_through(code.p_data + last_offset)) {
+        *error = BM0__et__program_runs_past_end;
+
+        return last_offset;
+    }
+
+    return code_length;
+}
+
+/* Decoded Programs */
+// decoded instruction type
+typedef enum BM0__dit {
+    BM0__dit__resolve, // looks up the instruction at the instruction pointer
+    BM0__dit__reference, // runs one instruction through BM0__step_byte_machine
+    BM0__dit__write_register,
+    BM0__dit__allocate,
+    BM0__dit__deallocate,
+    BM0__dit__buffer_to_register,
+    BM0__dit__register_to_register,
+    BM0__dit__register_to_buffer,
+    BM0__dit__operate,
+    BM0__dit__do_x86_64_linux_syscall_limited,
+    BM0__dit__buffer_to_buffer,
+    BM0__dit__fill_buffer,
+    BM0__dit__compare_buffers,
+    BM0__dit__buffer_to_vector,
+    BM0__dit__vector_to_buffer,
+    BM0__dit__register_to_vector,
+    BM0__dit__vector_operate,
+    BM0__dit__reduce_vector,
+    BM0__dit__submit_io,
+    BM0__dit__complete_io,
+
+    // operate with the operation inside the instruction, two per BM0__ot in BM0__ot order, always performed then flag bit checked
+    BM0__dit__operate__binary__right_shift,
+    BM0__dit__operate__binary__right_shift__flag_bit,
+    BM0__dit__operate__binary__left_shift,
+    BM0__dit__operate__binary__left_shift__flag_bit,
+    BM0__dit__operate__binary__not,
+    BM0__dit__operate__binary__not__flag_bit,
+    BM0__dit__operate__binary__and,
+    BM0__dit__operate__binary__and__flag_bit,
+    BM0__dit__operate__binary__or,
+    BM0__dit__operate__binary__or__flag_bit,
+    BM0__dit__operate__binary__xor,
+    BM0__dit__operate__binary__xor__flag_bit,
+    BM0__dit__operate__integer__add,
+    BM0__dit__operate__integer__add__flag_bit,
+    BM0__dit__operate__integer__subtract,
+    BM0__dit__operate__integer__subtract__flag_bit,
+    BM0__dit__operate__integer__multiply,
+    BM0__dit__operate__integer__multiply__flag_bit,
+    BM0__dit__operate__integer__divide,
+    BM0__dit__operate__integer__divide__flag_bit,
+    BM0__dit__operate__integer__modulous,
+    BM0__dit__operate__integer__modulous__flag_bit,
+    BM0__dit__operate__comparison__less_than,
+    BM0__dit__operate__comparison__less_than__flag_bit,
+    BM0__dit__operate__comparison__equal_to,
+    BM0__dit__operate__comparison__equal_to__flag_bit,
+    BM0__dit__operate__comparison__not_equal_to,
+    BM0__dit__operate__comparison__not_equal_to__flag_bit,
+    BM0__dit__operate__comparison__greater_than,
+    BM0__dit__operate__comparison__greater_than__flag_bit,
+
+    // superinstructions made by BM0__optimize_program, each runs a few instructions with one dispatch
+    BM0__dit__load_indexed, // operate add, then buffer to register through its result
+    BM0__dit__add_immediate, // write register, then operate add reading it
+    BM0__dit__compare_and_branch, // operate comparison, write register, then operate add into the instruction pointer on the comparison's flag
+
+    // channels
+    BM0__dit__send_to_channel,
+    BM0__dit__receive_from_channel,
+
+    // threads, spawn and join are left to the reference engine
+    BM0__dit__atomic_operate,
+
+    // allocation policies
+    BM0__dit__allocate_with_policy,
+
+    // hash tables
+    BM0__dit__hash_table_operate
+} BM0__dit;
+
+// reserved decoded instruction indices
+typedef enum BM0__dii {
+    BM0__dii__resolve = 0,
+    BM0__dii__reference = 1,
+    BM0__dii__RESERVED_COUNT = 2
+} BM0__dii;
+
+// one instruction, 32 bytes wide so that entries never straddle cache lines
+typedef struct BM0__decoded_instruction {
+    unsigned long long p_immediate; // write register value or operate flag mask
+    void* p_next_instruction_pointer;
+    unsigned int p_next_index; // BM0__dii__resolve when not yet known
+    unsigned short p_type; // BM0__dit
+    unsigned char p_length;
+    unsigned char p_operate_mode; // BM0__omt
+    unsigned char p_parameters[BM0__define__max_parameter_count];
+} BM0__decoded_instruction;
+
+// compiled code of a program, see BM0__attach_jit_to_program
+typedef struct BM0__jit BM0__jit;
+
+typedef struct BM0__program {
+    BM0__buffer p_code; // input buffer 0, not owned by the program
+    BM0__buffer p_offset_map; // one unsigned int per code byte, zero if not decoded, otherwise instruction index + 1
+    BM0__buffer p_instructions; // BM0__decoded_instruction array
+    unsigned long long p_instruction_count;
+    BM0__jit* p_jit; // zero unless the program is compiled
+    BM0__buffer p_file; // mapping the program was loaded from by BM0__load_program, holds the code and until they grow the tables
+} BM0__program;
+
+// checks if a table of a program lives inside the file it was loaded from, those are freed with the file instead
+BM0__boolean BM0__check_program_file_owns(BM0__program* program, BM0__buffer table) {
+    return (BM0__boolean)(table.p_data >= program->p_file.p_data && table.p_data < program->p_file.p_data + program->p_file.p_length);
+}
+
+BM0__boolean BM0__check_decoded_register_is_parameter_register(unsigned char register_index) {
+    return (BM0__boolean)(register_index >= BM0__rt__instruction_ID_register && register_index <= BM0__rt__instruction_parameter_register_7);
+}
+
+// decodes the instruction at a code offset, anything the decoded engine cannot run exactly like the reference engine becomes a reference instruction
+void BM0__decode_instruction(BM0__program* program, unsigned long long offset, BM0__decoded_instruction* instruction) {
+    unsigned short opcode = 0;
+    unsigned long long length;
+    unsigned char* parameters = instruction->p_parameters;
+    BM0__boolean reference = BM0__boolean__false;
+
+    // setup blank instruction
+    instruction->p_immediate = 0;
+    instruction->p_next_index = BM0__dii__resolve;
+    instruction->p_type = BM0__dit__reference;
+    instruction->p_length = 0;
+    instruction->p_operate_mode = 0;
+    for (unsigned long long i = 0; i < BM0__define__max_parameter_count; i++) {
+        parameters[i] = 0;
+    }
+
+    // get opcode and length
+    if (offset + 2 > program->p_code.p_length) {
+        return;
+    }
+    BM0__copy_bytes(program->p_code.p_data + offset, 2, &opcode);
+    length = BM0__write_instruction__get_instruction_ilt((BM0__it)opcode);
+    if (length == 0 || offset + length > program->p_code.p_length) {
+        return;
+    }
+
+    // read parameters
+    instruction->p_length = (unsigned char)length;
+    instruction->p_next_instruction_pointer = program->p_code.p_data + offset + length;
+    if (opcode == BM0__it__write_register) {
+        parameters[0] = *(unsigned char*)(program->p_code.p_data + offset + 2);
+        BM0__copy_bytes(program->p_code.p_data + offset + 3, sizeof(unsigned long long), &instruction->p_immediate);
+    } else {
+        BM0__copy_bytes(program->p_code.p_data + offset + 2, length - 2, parameters);
+    }
+
+    // registers 1 - 9 are only written by the reference engine, so instructions touching them are left to it
+    switch ((BM0__it)opcode) {
+    case BM0__it__quit:
+        reference = BM0__boolean__true;
+
+        break;
+    case BM0__it__write_register:
+        instruction->p_type = BM0__dit__write_register;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]);
+
+        break;
+    case BM0__it__allocate:
+        instruction->p_type = BM0__dit__allocate;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]);
+
+        break;
+    case BM0__it__deallocate:
+        instruction->p_type = BM0__dit__deallocate;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]);
+
+        break;
+    case BM0__it__buffer_to_register:
+        // transfer sizes are checked once here instead of every time the instruction runs, the reference engine reports invalid ones
+        instruction->p_type = BM0__dit__buffer_to_register;
+        reference = parameters[1] > sizeof(unsigned long long) || BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__register_to_register:
+        instruction->p_type = BM0__dit__register_to_register;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]);
+
+        break;
+    case BM0__it__register_to_buffer:
+        instruction->p_type = BM0__dit__register_to_buffer;
+        reference = parameters[1] > sizeof(unsigned long long) || BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__operate:
+        instruction->p_type = BM0__dit__operate;
+        instruction->p_operate_mode = (unsigned char)BM0__get_operate_mode(parameters[1]);
+        instruction->p_immediate = BM0__get_operate_flag_mask(parameters[1]);
+        if (parameters[2] <= BM0__ot__comparison__greater_than && instruction->p_operate_mode == BM0__omt__always__direct_operation) {
+            instruction->p_type = BM0__dit__operate__binary__right_shift + (parameters[2] * 2);
+        } else if (parameters[2] <= BM0__ot__comparison__greater_than && instruction->p_operate_mode == BM0__omt__flag_bit__direct_operation) {
+            instruction->p_type = BM0__dit__operate__binary__right_shift__flag_bit + (parameters[2] * 2);
+        }
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[3]) || BM0__check_decoded_register_is_parameter_register(parameters[4]) || BM0__check_decoded_register_is_parameter_register(parameters[5]);
+        if (instruction->p_operate_mode == BM0__omt__flag_bit__register_operation || instruction->p_operate_mode == BM0__omt__always__register_operation) {
+            reference = reference || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+        }
+
+        break;
+    case BM0__it__do_x86_64_linux_syscall_limited:
+        instruction->p_type = BM0__dit__do_x86_64_linux_syscall_limited;
+        reference = parameters[0] > BM0__st__futex_wake || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]) || BM0__check_decoded_register_is_parameter_register(parameters[7]);
+        if (parameters[0] >= BM0__st__mmap) {
+            reference = reference || BM0__check_decoded_register_is_parameter_register(parameters[4]) || BM0__check_decoded_register_is_parameter_register(parameters[5]) || BM0__check_decoded_register_is_parameter_register(parameters[6]);
+        }
+
+        break;
+    case BM0__it__buffer_to_buffer:
+        instruction->p_type = BM0__dit__buffer_to_buffer;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__fill_buffer:
+        instruction->p_type = BM0__dit__fill_buffer;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__compare_buffers:
+        instruction->p_type = BM0__dit__compare_buffers;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]);
+
+        break;
+    case BM0__it__buffer_to_vector:
+        instruction->p_type = BM0__dit__buffer_to_vector;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]);
+
+        break;
+    case BM0__it__vector_to_buffer:
+        instruction->p_type = BM0__dit__vector_to_buffer;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[1]);
+
+        break;
+    case BM0__it__register_to_vector:
+        instruction->p_type = BM0__dit__register_to_vector;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[1]);
+
+        break;
+    case BM0__it__vector_operate:
+        instruction->p_type = BM0__dit__vector_operate;
+        instruction->p_operate_mode = (unsigned char)BM0__get_operate_mode(parameters[1]);
+        instruction->p_immediate = BM0__get_operate_flag_mask(parameters[1]);
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || ((instruction->p_operate_mode == BM0__omt__flag_bit__register_operation || instruction->p_operate_mode == BM0__omt__always__register_operation) && BM0__check_decoded_register_is_parameter_register(parameters[2]));
+
+        break;
+    case BM0__it__reduce_vector:
+        instruction->p_type = BM0__dit__reduce_vector;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[3]);
+
+        break;
+    case BM0__it__submit_io:
+        instruction->p_type = BM0__dit__submit_io;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__complete_io:
+        instruction->p_type = BM0__dit__complete_io;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]);
+
+        break;
+    case BM0__it__send_to_channel:
+        instruction->p_type = BM0__dit__send_to_channel;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]);
+
+        break;
+    case BM0__it__receive_from_channel:
+        instruction->p_type = BM0__dit__receive_from_channel;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]);
+
+        break;
+    case BM0__it__spawn:
+    case BM0__it__join:
+        reference = BM0__boolean__true;
+
+        break;
+    case BM0__it__atomic_operate:
+        instruction->p_type = BM0__dit__atomic_operate;
+        reference = parameters[0] > BM0__aot__fence || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]) || BM0__check_decoded_register_is_parameter_register(parameters[4]);
+
+        break;
+    case BM0__it__allocate_with_policy:
+        instruction->p_type = BM0__dit__allocate_with_policy;
+        reference = BM0__check_decoded_register_is_parameter_register(parameters[0]) || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]) || BM0__check_decoded_register_is_parameter_register(parameters[4]);
+
+        break;
+    case BM0__it__hash_table_operate:
+        instruction->p_type = BM0__dit__hash_table_operate;
+        reference = parameters[0] > BM0__hot__clear || BM0__check_decoded_register_is_parameter_register(parameters[1]) || BM0__check_decoded_register_is_parameter_register(parameters[2]) || BM0__check_decoded_register_is_parameter_register(parameters[3]) || BM0__check_decoded_register_is_parameter_register(parameters[4]);
+
+        break;
+    }
+
+    if (reference) {
+        instruction->p_type = BM0__dit__reference;
+    }
+
+    return;
+}
+
+unsigned int* BM0__get_program_offset_map(BM0__program* program) {
+    return (unsigned int*)program->p_offset_map.p_data;
+}
+
+BM0__decoded_instruction* BM0__get_program_instructions(BM0__program* program) {
+    return (BM0__decoded_instruction*)program->p_instructions.p_data;
+}
+
+// links an instruction to the instruction right after it, if that one is decoded
+void BM0__link_decoded_instruction(BM0__program* program, unsigned long long index) {
+    BM0__decoded_instruction* instruction = &BM0__get_program_instructions(program)[index];
+    unsigned long long next_offset = (unsigned long long)(instruction->p_next_instruction_pointer - program->p_code.p_data);
+
+    if (instruction->p_length != 0 && next_offset < program->p_code.p_length) {
+        instruction->p_next_index = BM0__get_program_offset_map(program)[next_offset];
+
+        // map stores index + 1, zero meaning not decoded which is also BM0__dii__resolve
+        if (instruction->p_next_index != 0) {
+            instruction->p_next_index--;
+        }
+    } else {
+        instruction->p_next_index = BM0__dii__resolve;
+    }
+
+    return;
+}
+
+// decodes and records the instruction at a code offset, returns its index or BM0__dii__reference if it could not be stored
+unsigned long long BM0__add_decoded_instruction(BM0__program* program, unsigned long long offset) {
+    BM0__et error = BM0__et__no_error;
+    BM0__buffer instructions;
+    unsigned long long index;
+
+    // grow instruction list
+    if ((program->p_instruction_count + 1) * sizeof(BM0__decoded_instruction) > program->p_instructions.p_length) {
+        instructions = BM0__create_buffer(&error, program->p_instructions.p_length * 2);
+        if (error != BM0__et__no_error) {
+            return BM0__dii__reference;
+        }
+
+        BM0__copy_bytes(program->p_instructions.p_data, program->p_instruction_count * sizeof(BM0__decoded_instruction), instructions.p_data);
+        if (BM0__check_program_file_owns(program, program->p_instructions) == BM0__boolean__false) {
+            BM0__destroy_buffer(program->p_instructions);
+        }
+        program->p_instructions = instructions;
+    }
+
+    // decode instruction
+    index = program->p_instruction_count;
+    BM0__decode_instruction(program, offset, &BM0__get_program_instructions(program)[index]);
+    BM0__get_program_offset_map(program)[offset] = (unsigned int)index + 1;
+    program->p_instruction_count++;
+    BM0__link_decoded_instruction(program, index);
+
+    // link any decoded instruction that ends where this one begins
+    for (unsigned long long i = 1; i <= BM0__define__max_instruction_length && i <= offset; i++) {
+        if (BM0__get_program_offset_map(program)[offset - i] != 0) {
+            BM0__link_decoded_instruction(program, BM0__get_program_offset_map(program)[offset - i] - 1);
+        }
+    }
+
+    return index;
+}
+
+// returns the decoded instruction index for an instruction pointer, decoding on demand
+unsigned long long BM0__find_decoded_instruction(BM0__program* program, void* instruction_pointer) {
+    unsigned long long offset = (unsigned long long)(instruction_pointer - program->p_code.p_data);
+
+    // instruction pointer left the program buffer
+    if (offset >= program->p_code.p_length) {
+        return BM0__dii__reference;
+    }
+
+    // already decoded
+    if (BM0__get_program_offset_map(program)[offset] != 0) {
+        return BM0__get_program_offset_map(program)[offset] - 1;
+    }
+
+    return BM0__add_decoded_instruction(program, offset);
+}
+
+/* Just In Time Compilation */
+#ifdef BM0__enable__jit
+// host register numbers
+typedef enum BM0__jhr {
+    BM0__jhr__rax = 0,
+    BM0__jhr__rcx = 1,
+    BM0__jhr__rdx = 2,
+    BM0__jhr__rbx = 3,
+    BM0__jhr__rsi = 6,
+    BM0__jhr__r12 = 12,
+    BM0__jhr__r13 = 13,
+    BM0__jhr__r14 = 14,
+    BM0__jhr__r15 = 15
+} BM0__jhr;
+
+// block exit status
+typedef enum BM0__jbs {
+    BM0__jbs__lookup, // continue at the instruction pointer, possibly in another block
+    BM0__jbs__interpret, // run the instruction at the instruction pointer in the decoded engine
+    BM0__jbs__out_of_budget // the budget cannot cover another pass through the block, the decoded engine runs what is left of it
+} BM0__jbs;
+
+// block table markers, anything else is a compiled block
+typedef enum BM0__jbm {
+    BM0__jbm__not_compiled = 0,
+    BM0__jbm__uncompilable = 1
+} BM0__jbm;
+
+typedef unsigned long long (*BM0__jit_block)(void** regs);
+
+struct BM0__jit {
+    BM0__buffer p_code; // executable code region
+    unsigned long long p_code_used;
+    BM0__boolean p_code_writable;
+    BM0__buffer p_blocks; // one void* per decoded instruction, see BM0__jbm
+    BM0__buffer p_heat; // one unsigned char per decoded instruction, counts entries until compiled
+    unsigned long long p_budget; // instructions the decoded engine may still run, blocks take a whole pass out of it up front
+
+    // block being compiled
+    unsigned char p_cached_registers[BM0__define__jit_cached_register_count];
+    unsigned long long p_cached_register_count;
+};
+
+void BM0__destroy_jit(BM0__jit* jit) {
+    BM0__destroy_buffer(jit->p_code);
+    BM0__destroy_buffer(jit->p_blocks);
+    BM0__destroy_buffer(jit->p_heat);
+    BM0__deallocate(jit, sizeof(BM0__jit));
+
+    return;
+}
+
+// forgets every compiled block, used when the program's code changes
+void BM0__reset_jit(BM0__jit* jit) {
+    for (unsigned long long i = 0; i < jit->p_blocks.p_length / sizeof(void*); i++) {
+        ((void**)jit->p_blocks.p_data)[i] = (void*)BM0__jbm__not_compiled;
+        ((unsigned char*)jit->p_heat.p_data)[i] = 0;
+    }
+    jit->p_code_used = 0;
+
+    return;
+}
+
+// makes sure the block and heat tables cover an instruction index
+BM0__boolean BM0__grow_jit_tables(BM0__jit* jit, unsigned long long index) {
+    BM0__et error = BM0__et__no_error;
+    unsigned long long count = jit->p_blocks.p_length / sizeof(void*);
+    BM0__buffer blocks;
+    BM0__buffer heat;
+
+    if (index < count) {
+        return BM0__boolean__true;
+    }
+
+    // double until the index fits
+    while (count <= index) {
+        count *= 2;
+    }
+    blocks = BM0__create_buffer(&error, count * sizeof(void*));
+    heat = BM0__create_buffer(&error, count);
+    if (error != BM0__et__no_error) {
+        // free whichever of the two was made
+        if (blocks.p_data != 0) {
+            BM0__destroy_buffer(blocks);
+        }
+        if (heat.p_data != 0) {
+            BM0__destroy_buffer(heat);
+        }
+
+        return BM0__boolean__false;
+    }
+
+    BM0__copy_bytes(jit->p_blocks.p_data, jit->p_blocks.p_length, blocks.p_data);
+    BM0__copy_bytes(jit->p_heat.p_data, jit->p_heat.p_length, heat.p_data);
+    BM0__destroy_buffer(jit->p_blocks);
+    BM0__destroy_buffer(jit->p_heat);
+    jit->p_blocks = blocks;
+    jit->p_heat = heat;
+
+    return BM0__boolean__true;
+}
+
+// makes a program's decoded engine compile hot code to x86-64
+void BM0__attach_jit_to_program(BM0__et* error, BM0__program* program) {
+    BM0__jit* jit = (BM0__jit*)BM0__allocate(sizeof(BM0__jit));
+
+    if (jit == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return;
+    }
+
+    // setup code region and tables
+    jit->p_code = BM0__create_buffer(error, (program->p_code.p_length * BM0__define__jit_code_bytes_per_program_byte) + BM0__define__jit_minimum_code_length);
+    jit->p_code_used = 0;
+    jit->p_code_writable = BM0__boolean__true;
+    jit->p_blocks = BM0__create_buffer(error, (program->p_instructions.p_length / sizeof(BM0__decoded_instruction)) * sizeof(void*));
+    jit->p_heat = BM0__create_buffer(error, program->p_instructions.p_length / sizeof(BM0__decoded_instruction));
+    jit->p_cached_register_count = 0;
+    if (*error != BM0__et__no_error) {
+        BM0__destroy_jit(jit);
+
+        return;
+    }
+
+    program->p_jit = jit;
+
+    return;
+}
+
+/* Just In Time Compilation - x86-64 Encoding */
+void BM0__jit__emit_byte(BM0__jit* jit, unsigned char byte) {
+    ((unsigned char*)jit->p_code.p_data)[jit->p_code_used] = byte;
+    jit->p_code_used++;
+
+    return;
+}
+
+void BM0__jit__emit_u32(BM0__jit* jit, unsigned int value) {
+    BM0__copy_bytes(&value, sizeof(unsigned int), jit->p_code.p_data + jit->p_code_used);
+    jit->p_code_used += sizeof(unsigned int);
+
+    return;
+}
+
+void BM0__jit__emit_u64(BM0__jit* jit, unsigned long long value) {
+    BM0__copy_bytes(&value, sizeof(unsigned long long), jit->p_code.p_data + jit->p_code_used);
+    jit->p_code_used += sizeof(unsigned long long);
+
+    return;
+}
+
+// opcode with a register to register operand, reg is a register or an opcode extension
+void BM0__jit__emit_register_register(BM0__jit* jit, unsigned char opcode_prefix, unsigned char opcode, unsigned char reg, unsigned char rm) {
+    BM0__jit__emit_byte(jit, 0x48 | ((reg >> 3) << 2) | (rm >> 3));
+    if (opcode_prefix != 0) {
+        BM0__jit__emit_byte(jit, opcode_prefix);
+    }
+    BM0__jit__emit_byte(jit, opcode);
+    BM0__jit__emit_byte(jit, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+
+    return;
+}
+
+// opcode with a [rbx + displacement] operand, which is how byte machine registers are addressed
+void BM0__jit__emit_register_memory(BM0__jit* jit, unsigned char opcode, unsigned char reg, unsigned int displacement) {
+    BM0__jit__emit_byte(jit, 0x48 | ((reg >> 3) << 2));
+    BM0__jit__emit_byte(jit, opcode);
+    BM0__jit__emit_byte(jit, 0x80 | ((reg & 7) << 3) | BM0__jhr__rbx);
+    BM0__jit__emit_u32(jit, displacement);
+
+    return;
+}
+
+void BM0__jit__emit_move_immediate(BM0__jit* jit, unsigned char reg, unsigned long long value) {
+    BM0__jit__emit_byte(jit, 0x48 | (reg >> 3));
+    BM0__jit__emit_byte(jit, 0xB8 | (reg & 7));
+    BM0__jit__emit_u64(jit, value);
+
+    return;
+}
+
+// conditional (0x0F 0x8N) or unconditional (0xE9) 32-bit relative jump, returns the offset to patch
+unsigned long long BM0__jit__emit_jump(BM0__jit* jit, unsigned char condition) {
+    if (condition == 0) {
+        BM0__jit__emit_byte(jit, 0xE9);
+    } else {
+        BM0__jit__emit_byte(jit, 0x0F);
+        BM0__jit__emit_byte(jit, condition);
+    }
+    BM0__jit__emit_u32(jit, 0);
+
+    return jit->p_code_used - sizeof(unsigned int);
+}
+
+void BM0__jit__patch_jump(BM0__jit* jit, unsigned long long patch_offset, unsigned long long target_offset) {
+    unsigned int relative = (unsigned int)(target_offset - (patch_offset + sizeof(unsigned int)));
+
+    BM0__copy_bytes(&relative, sizeof(unsigned int), jit->p_code.p_data + patch_offset);
+
+    return;
+}
+
+/* Just In Time Compilation - Byte Machine Registers */
+// returns the host register caching a byte machine register, or 0 if it lives in memory
+unsigned char BM0__jit__get_cached_register(BM0__jit* jit, unsigned char bm0_register) {
+    for (unsigned long long i = 0; i < jit->p_cached_register_count; i++) {
+        if (jit->p_cached_registers[i] == bm0_register) {
+            return BM0__jhr__r12 + i;
+        }
+    }
+
+    return 0;
+}
+
+// the instruction pointer is read as a constant since blocks end at every write to it
+void BM0__jit__emit_load(BM0__jit* jit, unsigned char host_register, unsigned char bm0_register, void* instruction_pointer) {
+    unsigned char cached = BM0__jit__get_cached_register(jit, bm0_register);
+
+    if (bm0_register == BM0__rt__instruction_pointer_register) {
+        BM0__jit__emit_move_immediate(jit, host_register, (unsigned long long)instruction_pointer);
+    } else if (cached != 0) {
+        BM0__jit__emit_register_register(jit, 0, 0x89, cached, host_register);
+    } else {
+        BM0__jit__emit_register_memory(jit, 0x8B, host_register, bm0_register * sizeof(void*));
+    }
+
+    return;
+}
+
+void BM0__jit__emit_store(BM0__jit* jit, unsigned char bm0_register, unsigned char host_register) {
+    unsigned char cached = BM0__jit__get_cached_register(jit, bm0_register);
+
+    if (cached != 0) {
+        BM0__jit__emit_register_register(jit, 0, 0x89, host_register, cached);
+    } else {
+        BM0__jit__emit_register_memory(jit, 0x89, host_register, bm0_register * sizeof(void*));
+    }
+
+    return;
+}
+
+void BM0__jit__emit_set_instruction_pointer(BM0__jit* jit, void* instruction_pointer) {
+    BM0__jit__emit_move_immediate(jit, BM0__jhr__rdx, (unsigned long long)instruction_pointer);
+    BM0__jit__emit_register_memory(jit, 0x89, BM0__jhr__rdx, 0);
+
+    return;
+}
+
+// writes cached registers back, optionally sets the instruction pointer and returns a BM0__jbs
+void BM0__jit__emit_exit(BM0__jit* jit, void* instruction_pointer, BM0__jbs status) {
+    for (unsigned long long i = 0; i < jit->p_cached_register_count; i++) {
+        BM0__jit__emit_register_memory(jit, 0x89, BM0__jhr__r12 + i, jit->p_cached_registers[i] * sizeof(void*));
+    }
+    if (instruction_pointer != 0) {
+        BM0__jit__emit_set_instruction_pointer(jit, instruction_pointer);
+    }
+
+    // mov eax, status
+    BM0__jit__emit_byte(jit, 0xB8);
+    BM0__jit__emit_u32(jit, status);
+
+    // pop r15, r14, r13, r12, rbx and return
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x5F);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x5E);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x5D);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x5C);
+    BM0__jit__emit_byte(jit, 0x5B);
+    BM0__jit__emit_byte(jit, 0xC3);
+
+    return;
+}
+
+/* Just In Time Compilation - Blocks */
+// checks if an instruction can be compiled
+BM0__boolean BM0__jit__check_instruction(BM0__decoded_instruction* instruction) {
+    switch ((BM0__dit)instruction->p_type) {
+    case BM0__dit__write_register:
+    case BM0__dit__register_to_register:
+        return BM0__boolean__true;
+    case BM0__dit__buffer_to_register:
+        // partial loads into the instruction pointer are left to the engine
+        return (BM0__boolean)(instruction->p_parameters[2] != BM0__rt__instruction_pointer_register && (instruction->p_parameters[1] == 0 || instruction->p_parameters[1] == 1 || instruction->p_parameters[1] == 2 || instruction->p_parameters[1] == 4 || instruction->p_parameters[1] == 8));
+    case BM0__dit__register_to_buffer:
+        return (BM0__boolean)(instruction->p_parameters[1] == 0 || instruction->p_parameters[1] == 1 || instruction->p_parameters[1] == 2 || instruction->p_parameters[1] == 4 || instruction->p_parameters[1] == 8);
+    default:
+        return (BM0__boolean)(instruction->p_type >= BM0__dit__operate__binary__right_shift && instruction->p_type <= BM0__dit__operate__comparison__greater_than__flag_bit);
+    }
+}
+
+// checks if a compilable instruction writes the instruction pointer, which ends a block
+BM0__boolean BM0__jit__check_jump(BM0__decoded_instruction* instruction) {
+    switch ((BM0__dit)instruction->p_type) {
+    case BM0__dit__write_register:
+        return (BM0__boolean)(instruction->p_parameters[0] == BM0__rt__instruction_pointer_register);
+    case BM0__dit__register_to_register:
+        return (BM0__boolean)(instruction->p_parameters[1] == BM0__rt__instruction_pointer_register);
+    case BM0__dit__buffer_to_register:
+    case BM0__dit__register_to_buffer:
+        return BM0__boolean__false;
+    default:
+        return (BM0__boolean)(instruction->p_parameters[5] == BM0__rt__instruction_pointer_register);
+    }
+}
+
+// picks the most used registers of a block to live in host registers
+void BM0__jit__choose_cached_registers(BM0__jit* jit, BM0__program* program, unsigned long long* indices, unsigned long long count) {
+    unsigned int uses[BM0__define__register_count];
+    BM0__decoded_instruction* instruction;
+    unsigned long long best;
+
+    // count uses
+    for (unsigned long long i = 0; i < BM0__define__register_count; i++) {
+        uses[i] = 0;
+    }
+    for (unsigned long long i = 0; i < count; i++) {
+        instruction = &BM0__get_program_instructions(program)[indices[i]];
+
+        switch ((BM0__dit)instruction->p_type) {
+        case BM0__dit__write_register:
+            uses[instruction->p_parameters[0]]++;
+
+            break;
+        case BM0__dit__register_to_register:
+            uses[instruction->p_parameters[0]]++;
+            uses[instruction->p_parameters[1]]++;
+
+            break;
+        case BM0__dit__buffer_to_register:
+        case BM0__dit__register_to_buffer:
+            uses[instruction->p_parameters[0]]++;
+            uses[instruction->p_parameters[2]]++;
+
+            break;
+        default:
+            if ((instruction->p_type - BM0__dit__operate__binary__right_shift) & 1) {
+                uses[instruction->p_parameters[0]]++;
+            }
+            uses[instruction->p_parameters[3]]++;
+            uses[instruction->p_parameters[4]]++;
+            uses[instruction->p_parameters[5]]++;
+
+            break;
+        }
+    }
+
+    // the instruction pointer is never cached
+    uses[BM0__rt__instruction_pointer_register] = 0;
+
+    // take the most used registers that are used more than once
+    jit->p_cached_register_count = 0;
+    while (jit->p_cached_register_count < BM0__define__jit_cached_register_count) {
+        best = 0;
+        for (unsigned long long i = 1; i < BM0__define__register_count; i++) {
+            if (uses[i] > uses[best]) {
+                best = i;
+            }
+        }
+        if (uses[best] < 2) {
+            break;
+        }
+
+        jit->p_cached_registers[jit->p_cached_register_count] = (unsigned char)best;
+        jit->p_cached_register_count++;
+        uses[best] = 0;
+    }
+
+    return;
+}
+
+// compiles the operation of a specialized operate instruction, sources in rax and rcx, result in rax
+void BM0__jit__emit_operation(BM0__jit* jit, BM0__decoded_instruction* instruction, void* instruction_pointer) {
+    unsigned long long patch;
+
+    switch ((BM0__ot)((instruction->p_type - BM0__dit__operate__binary__right_shift) / 2)) {
+    case BM0__ot__binary__right_shift:
+        BM0__jit__emit_register_register(jit, 0, 0xD3, 5, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__binary__left_shift:
+        BM0__jit__emit_register_register(jit, 0, 0xD3, 4, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__binary__not:
+        BM0__jit__emit_register_register(jit, 0, 0xF7, 2, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__binary__and:
+        BM0__jit__emit_register_register(jit, 0, 0x21, BM0__jhr__rcx, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__binary__or:
+        BM0__jit__emit_register_register(jit, 0, 0x09, BM0__jhr__rcx, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__binary__xor:
+        BM0__jit__emit_register_register(jit, 0, 0x31, BM0__jhr__rcx, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__integer__add:
+        BM0__jit__emit_register_register(jit, 0, 0x01, BM0__jhr__rcx, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__integer__subtract:
+        BM0__jit__emit_register_register(jit, 0, 0x29, BM0__jhr__rcx, BM0__jhr__rax);
+
+        break;
+    case BM0__ot__integer__multiply:
+        BM0__jit__emit_register_register(jit, 0x0F, 0xAF, BM0__jhr__rax, BM0__jhr__rcx);
+
+        break;
+    case BM0__ot__integer__divide:
+    case BM0__ot__integer__modulous:
+        // zero divisors leave the block so the engine can report the error
+        BM0__jit__emit_register_register(jit, 0, 0x85, BM0__jhr__rcx, BM0__jhr__rcx);
+        patch = BM0__jit__emit_jump(jit, 0x85);
+        BM0__jit__emit_exit(jit, instruction_pointer, BM0__jbs__interpret);
+        BM0__jit__patch_jump(jit, patch, jit->p_code_used);
+
+        // xor edx, edx then div rcx
+        BM0__jit__emit_byte(jit, 0x31);
+        BM0__jit__emit_byte(jit, 0xD2);
+        BM0__jit__emit_register_register(jit, 0, 0xF7, 6, BM0__jhr__rcx);
+        if ((instruction->p_type - BM0__dit__operate__binary__right_shift) / 2 == BM0__ot__integer__modulous) {
+            BM0__jit__emit_register_register(jit, 0, 0x89, BM0__jhr__rdx, BM0__jhr__rax);
+        }
+
+        break;
+    case BM0__ot__comparison__less_than:
+    case BM0__ot__comparison__equal_to:
+    case BM0__ot__comparison__not_equal_to:
+    case BM0__ot__comparison__greater_than:
+        // cmp rax, rcx then setcc al and movzx eax, al
+        BM0__jit__emit_register_register(jit, 0, 0x39, BM0__jhr__rcx, BM0__jhr__rax);
+        BM0__jit__emit_byte(jit, 0x0F);
+        switch ((BM0__ot)((instruction->p_type - BM0__dit__operate__binary__right_shift) / 2)) {
+        case BM0__ot__comparison__less_than:
+            BM0__jit__emit_byte(jit, 0x92);
+
+            break;
+        case BM0__ot__comparison__equal_to:
+            BM0__jit__emit_byte(jit, 0x94);
+
+            break;
+        case BM0__ot__comparison__not_equal_to:
+            BM0__jit__emit_byte(jit, 0x95);
+
+            break;
+        default:
+            BM0__jit__emit_byte(jit, 0x97);
+
+            break;
+        }
+        BM0__jit__emit_byte(jit, 0xC0);
+        BM0__jit__emit_byte(jit, 0x0F);
+        BM0__jit__emit_byte(jit, 0xB6);
+        BM0__jit__emit_byte(jit, 0xC0);
+
+        break;
+    }
+
+    return;
+}
+
+// compiles one instruction
+void BM0__jit__emit_instruction(BM0__jit* jit, BM0__program* program, BM0__decoded_instruction* instruction) {
+    unsigned char* parameters = instruction->p_parameters;
+    void* instruction_pointer = instruction->p_next_instruction_pointer - instruction->p_length;
+    unsigned long long patch = 0;
+    BM0__boolean flag_bit = BM0__boolean__false;
+
+    switch ((BM0__dit)instruction->p_type) {
+    case BM0__dit__write_register:
+        BM0__jit__emit_move_immediate(jit, BM0__jhr__rax, instruction->p_immediate);
+        BM0__jit__emit_store(jit, parameters[0], BM0__jhr__rax);
+
+        break;
+    case BM0__dit__register_to_register:
+        BM0__jit__emit_load(jit, BM0__jhr__rax, parameters[0], instruction_pointer);
+        BM0__jit__emit_store(jit, parameters[1], BM0__jhr__rax);
+
+        break;
+    case BM0__dit__buffer_to_register:
+        if (parameters[1] == 0) {
+            break;
+        }
+
+        // load from the pointer in rcx
+        BM0__jit__emit_load(jit, BM0__jhr__rcx, parameters[0], instruction_pointer);
+        switch (parameters[1]) {
+        case 1:
+            BM0__jit__emit_byte(jit, 0x0F);
+            BM0__jit__emit_byte(jit, 0xB6);
+
+            break;
+        case 2:
+            BM0__jit__emit_byte(jit, 0x0F);
+            BM0__jit__emit_byte(jit, 0xB7);
+
+            break;
+        case 4:
+            BM0__jit__emit_byte(jit, 0x8B);
+
+            break;
+        default:
+            BM0__jit__emit_byte(jit, 0x48);
+            BM0__jit__emit_byte(jit, 0x8B);
+
+            break;
+        }
+        BM0__jit__emit_byte(jit, 0x01);
+
+        // partial loads keep the destination's upper bytes
+        if (parameters[1] != sizeof(unsigned long long)) {
+            BM0__jit__emit_load(jit, BM0__jhr__rdx, parameters[2], instruction_pointer);
+            BM0__jit__emit_move_immediate(jit, BM0__jhr__rsi, ~((1ull << (parameters[1] * 8)) - 1));
+            BM0__jit__emit_register_register(jit, 0, 0x21, BM0__jhr__rsi, BM0__jhr__rdx);
+            BM0__jit__emit_register_register(jit, 0, 0x09, BM0__jhr__rdx, BM0__jhr__rax);
+        }
+        BM0__jit__emit_store(jit, parameters[2], BM0__jhr__rax);
+
+        break;
+    case BM0__dit__register_to_buffer:
+        if (parameters[1] == 0) {
+            break;
+        }
+
+        BM0__jit__emit_load(jit, BM0__jhr__rax, parameters[0], instruction_pointer);
+        BM0__jit__emit_load(jit, BM0__jhr__rcx, parameters[2], instruction_pointer);
+
+        // writes into the program leave the block so the engine can re-decode
+        BM0__jit__emit_register_register(jit, 0, 0x89, BM0__jhr__rcx, BM0__jhr__rdx);
+        BM0__jit__emit_move_immediate(jit, BM0__jhr__rsi, (unsigned long long)program->p_code.p_data - parameters[1] + 1);
+        BM0__jit__emit_register_register(jit, 0, 0x29, BM0__jhr__rsi, BM0__jhr__rdx);
+        BM0__jit__emit_move_immediate(jit, BM0__jhr__rsi, program->p_code.p_length + parameters[1] - 1);
+        BM0__jit__emit_register_register(jit, 0, 0x39, BM0__jhr__rsi, BM0__jhr__rdx);
+        patch = BM0__jit__emit_jump(jit, 0x83);
+        BM0__jit__emit_exit(jit, instruction_pointer, BM0__jbs__interpret);
+        BM0__jit__patch_jump(jit, patch, jit->p_code_used);
+
+        // store to the pointer in rcx
+        switch (parameters[1]) {
+        case 1:
+            BM0__jit__emit_byte(jit, 0x88);
+
+            break;
+        case 2:
+            BM0__jit__emit_byte(jit, 0x66);
+            BM0__jit__emit_byte(jit, 0x89);
+
+            break;
+        case 4:
+            BM0__jit__emit_byte(jit, 0x89);
+
+            break;
+        default:
+            BM0__jit__emit_byte(jit, 0x48);
+            BM0__jit__emit_byte(jit, 0x89);
+
+            break;
+        }
+        BM0__jit__emit_byte(jit, 0x01);
+
+        break;
+    default:
+        // flag bit variants are odd, skip the operation when the flag bit is clear
+        flag_bit = (BM0__boolean)((instruction->p_type - BM0__dit__operate__binary__right_shift) & 1);
+        if (flag_bit) {
+            BM0__jit__emit_load(jit, BM0__jhr__rax, parameters[0], instruction_pointer);
+            BM0__jit__emit_move_immediate(jit, BM0__jhr__rdx, instruction->p_immediate);
+            BM0__jit__emit_register_register(jit, 0, 0x85, BM0__jhr__rdx, BM0__jhr__rax);
+            patch = BM0__jit__emit_jump(jit, 0x84);
+        }
+
+        BM0__jit__emit_load(jit, BM0__jhr__rax, parameters[3], instruction_pointer);
+        BM0__jit__emit_load(jit, BM0__jhr__rcx, parameters[4], instruction_pointer);
+        BM0__jit__emit_operation(jit, instruction, instruction_pointer);
+        BM0__jit__emit_store(jit, parameters[5], BM0__jhr__rax);
+
+        if (flag_bit) {
+            BM0__jit__patch_jump(jit, patch, jit->p_code_used);
+        }
+
+        break;
+    }
+
+    return;
+}
+
+// compiles the straight line code starting at an instruction, returns the block or BM0__jbm__uncompilable
+void* BM0__jit__compile_block(BM0__jit* jit, BM0__program* program, unsigned long long index) {
+    unsigned long long indices[BM0__define__jit_max_block_length];
+    unsigned long long count = 0;
+    unsigned long long block_offset = jit->p_code_used;
+    unsigned long long body_offset;
+    unsigned long long patch;
+    BM0__decoded_instruction* instruction;
+    void* block_instruction_pointer;
+    void* end_instruction_pointer = 0;
+    BM0__boolean jumps = BM0__boolean__false;
+
+    // collect instructions until one cannot be compiled or writes the instruction pointer
+    while (count < BM0__define__jit_max_block_length) {
+        instruction = &BM0__get_program_instructions(program)[index];
+        if (index < BM0__dii__RESERVED_COUNT || BM0__jit__check_instruction(instruction) == BM0__boolean__false) {
+            break;
+        }
+
+        indices[count] = index;
+        count++;
+        end_instruction_pointer = instruction->p_next_instruction_pointer;
+        if (BM0__jit__check_jump(instruction)) {
+            jumps = BM0__boolean__true;
+
+            break;
+        }
+
+        // follow straight line code
+        index = instruction->p_next_index;
+        if (index == BM0__dii__resolve) {
+            index = BM0__find_decoded_instruction(program, instruction->p_next_instruction_pointer);
+        }
+    }
+    if (count == 0 || jit->p_code_used + ((count + 2) * BM0__define__jit_max_instruction_code_length) > jit->p_code.p_length) {
+        return (void*)BM0__jbm__uncompilable;
+    }
+
+    // make the code region writable again after a previous block
+    if (jit->p_code_writable == BM0__boolean__false) {
+        if (mprotect(jit->p_code.p_data, jit->p_code.p_length, PROT_READ | PROT_WRITE) != 0) {
+            return (void*)BM0__jbm__uncompilable;
+        }
+        jit->p_code_writable = BM0__boolean__true;
+    }
+
+    // prologue, push rbx, r12, r13, r14, r15 then mov rbx, rdi
+    BM0__jit__choose_cached_registers(jit, program, indices, count);
+    BM0__jit__emit_byte(jit, 0x53);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x54);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x55);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x56);
+    BM0__jit__emit_byte(jit, 0x41);
+    BM0__jit__emit_byte(jit, 0x57);
+    BM0__jit__emit_register_register(jit, 0, 0x89, 7, BM0__jhr__rbx);
+    for (unsigned long long i = 0; i < jit->p_cached_register_count; i++) {
+        BM0__jit__emit_register_memory(jit, 0x8B, BM0__jhr__r12 + i, jit->p_cached_registers[i] * sizeof(void*));
+    }
+    body_offset = jit->p_code_used;
+    instruction = &BM0__get_program_instructions(program)[indices[0]];
+    block_instruction_pointer = instruction->p_next_instruction_pointer - instruction->p_length;
+
+    // budget, mov rax, &budget then cmp qword [rax], count and sub qword [rax], count if it covers the pass
+    BM0__jit__emit_move_immediate(jit, BM0__jhr__rax, (unsigned long long)&jit->p_budget);
+    BM0__jit__emit_byte(jit, 0x48);
+    BM0__jit__emit_byte(jit, 0x81);
+    BM0__jit__emit_byte(jit, 0x38);
+    BM0__jit__emit_u32(jit, (unsigned int)count);
+    patch = BM0__jit__emit_jump(jit, 0x83);
+    BM0__jit__emit_exit(jit, block_instruction_pointer, BM0__jbs__out_of_budget);
+    BM0__jit__patch_jump(jit, patch, jit->p_code_used);
+    BM0__jit__emit_byte(jit, 0x48);
+    BM0__jit__emit_byte(jit, 0x81);
+    BM0__jit__emit_byte(jit, 0x28);
+    BM0__jit__emit_u32(jit, (unsigned int)count);
+
+    // body
+    for (unsigned long long i = 0; i < count; i++) {
+        instruction = &BM0__get_program_instructions(program)[indices[i]];
+
+        // the instruction pointer holds the jump's address until the jump lands
+        if (jumps && i == count - 1) {
+            BM0__jit__emit_set_instruction_pointer(jit, instruction->p_next_instruction_pointer - instruction->p_length);
+        }
+
+        BM0__jit__emit_instruction(jit, program, instruction);
+    }
+
+    // epilogue
+    if (jumps) {
+        // add qword [rbx], instruction length
+        BM0__jit__emit_byte(jit, 0x48);
+        BM0__jit__emit_byte(jit, 0x83);
+        BM0__jit__emit_byte(jit, 0x83);
+        BM0__jit__emit_u32(jit, 0);
+        BM0__jit__emit_byte(jit, instruction->p_length);
+
+        // loops back to the block's start stay in native code
+        BM0__jit__emit_register_memory(jit, 0x8B, BM0__jhr__rax, 0);
+        BM0__jit__emit_move_immediate(jit, BM0__jhr__rdx, (unsigned long long)block_instruction_pointer);
+        BM0__jit__emit_register_register(jit, 0, 0x39, BM0__jhr__rdx, BM0__jhr__rax);
+        patch = BM0__jit__emit_jump(jit, 0x84);
+        BM0__jit__patch_jump(jit, patch, body_offset);
+        BM0__jit__emit_exit(jit, 0, BM0__jbs__lookup);
+    } else {
+        BM0__jit__emit_exit(jit, end_instruction_pointer, BM0__jbs__lookup);
+    }
+
+    return jit->p_code.p_data + block_offset;
+}
+
+// runs compiled blocks from an instruction for as long as there are any, returns the instruction the engine continues with
+unsigned long long BM0__run_jit_blocks(BM0__program* program, void** regs, unsigned long long index) {
+    BM0__jit* jit = program->p_jit;
+    void* block;
+
+    while (BM0__grow_jit_tables(jit, index)) {
+        block = ((void**)jit->p_blocks.p_data)[index];
+
+        // compile hot instructions
+        if (block == (void*)BM0__jbm__not_compiled) {
+            if (((unsigned char*)jit->p_heat.p_data)[index] < BM0__define__jit_compile_threshold) {
+                ((unsigned char*)jit->p_heat.p_data)[index]++;
+
+                return index;
+            }
+
+            block = BM0__jit__compile_block(jit, program, index);
+            ((void**)jit->p_blocks.p_data)[index] = block;
+        }
+        if (block == (void*)BM0__jbm__uncompilable) {
+            return index;
+        }
+
+        // make the code region executable, a host refusing executable memory leaves every instruction to the decoded engine
+        if (jit->p_code_writable) {
+            if (mprotect(jit->p_code.p_data, jit->p_code.p_length, PROT_READ | PROT_EXEC) != 0) {
+                BM0__reset_jit(jit);
+                jit->p_code_used = jit->p_code.p_length;
+                ((void**)jit->p_blocks.p_data)[index] = (void*)BM0__jbm__uncompilable;
+
+                return index;
+            }
+            jit->p_code_writable = BM0__boolean__false;
+        }
+
+        // run block
+        if (((BM0__jit_block)block)(regs) != BM0__jbs__lookup) {
+            return BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]);
+        }
+        index = BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]);
+    }
+
+    return index;
+}
+#endif
+
+void BM0__destroy_program(BM0__program program) {
+    if (BM0__check_program_file_owns(&program, program.p_offset_map) == BM0__boolean__false) {
+        BM0__destroy_buffer(program.p_offset_map);
+    }
+    if (BM0__check_program_file_owns(&program, program.p_instructions) == BM0__boolean__false) {
+        BM0__destroy_buffer(program.p_instructions);
+    }
+    if (program.p_file.p_data != 0) {
+        BM0__destroy_buffer(program.p_file);
+    }
+#ifdef BM0__enable__jit
+    if (program.p_jit != 0) {
+        BM0__destroy_jit(program.p_jit);
+    }
+#endif
+
+    return;
+}
+
+// walks the program once from byte 0 until it runs out of valid instructions, the rest is decoded when first reached
+BM0__program BM0__create_program(BM0__et* error, BM0__buffer code) {
+    BM0__program output;
+    unsigned long long offset = 0;
+    unsigned long long index;
+
+    // setup program
+    output.p_code = code;
+    output.p_instruction_count = BM0__dii__RESERVED_COUNT;
+    output.p_jit = 0;
+    output.p_file = BM0__create_null_buffer();
+    output.p_offset_map = BM0__create_buffer(error, (code.p_length + 1) * sizeof(unsigned int));
+    output.p_instructions = BM0__create_buffer(error, ((code.p_length / BM0__ilt__deallocate) + BM0__dii__RESERVED_COUNT + 1) * sizeof(BM0__decoded_instruction));
+    if (*error != BM0__et__no_error) {
+        return output;
+    }
+
+    // setup reserved instructions
+    BM0__get_program_instructions(&output)[BM0__dii__resolve].p_type = BM0__dit__resolve;
+    BM0__get_program_instructions(&output)[BM0__dii__reference].p_type = BM0__dit__reference;
+
+    // decode straight line code
+    while (offset < code.p_length) {
+        index = BM0__add_decoded_instruction(&output, offset);
+        if (index == BM0__dii__reference || BM0__get_program_instructions(&output)[index].p_length == 0) {
+            break;
+        }
+
+        offset += BM0__get_program_instructions(&output)[index].p_length;
+    }
+
+    return output;
+}
+
+// re-decodes every instruction overlapping changed code bytes, must be called by the host after editing a decoded program's code
+void BM0__invalidate_program(BM0__program* program, unsigned long long offset, unsigned long long length) {
+    unsigned long long start = 0;
+    unsigned long long index;
+
+    // clamp range to the code
+    if (offset >= program->p_code.p_length) {
+        return;
+    }
+    if (length > program->p_code.p_length - offset) {
+        length = program->p_code.p_length - offset;
+    }
+    if (offset >= BM0__define__max_superinstruction_length) {
+        start = offset - BM0__define__max_superinstruction_length;
+    }
+#ifdef BM0__enable__jit
+    if (program->p_jit != 0) {
+        BM0__reset_jit(program->p_jit);
+    }
+#endif
+
+    // re-decode every decoded instruction that overlaps, which also splits superinstructions back up
+    for (unsigned long long i = start; i < offset + length; i++) {
+        if (BM0__get_program_offset_map(program)[i] != 0) {
+            index = BM0__get_program_offset_map(program)[i] - 1;
+            BM0__decode_instruction(program, i, &BM0__get_program_instructions(program)[index]);
+            BM0__link_decoded_instruction(program, index);
+        }
+    }
+
+    return;
+}
+
+// checks if a memory write touches a program's code
+BM0__boolean BM0__check_program_overlap(BM0__program* program, void* address, unsigned long long length) {
+    return (BM0__boolean)(address < program->p_code.p_data + program->p_code.p_length && address + length > program->p_code.p_data);
+}
+
+// invalidates the part of an overlapping memory write that landed inside a program's code
+void BM0__invalidate_program_write(BM0__program* program, void* address, unsigned long long length) {
+    if (address < program->p_code.p_data) {
+        length -= (unsigned long long)(program->p_code.p_data - address);
+        address = program->p_code.p_data;
+    }
+
+    BM0__invalidate_program(program, (unsigned long long)(address - program->p_code.p_data), length);
+
+    return;
+}
+
+/* Decoded Programs - Superinstructions */
+// fuses the decoded instruction at an index with the ones right after it when they make up a superinstruction
+void BM0__fuse_decoded_instruction(BM0__program* program, unsigned long long index) {
+    BM0__decoded_instruction* first = &BM0__get_program_instructions(program)[index];
+    BM0__decoded_instruction* second;
+    BM0__decoded_instruction* third;
+    BM0__decoded_instruction* last = 0;
+    BM0__decoded_instruction fused = *first;
+
+    // the instructions after it must be decoded
+    if (first->p_next_index == BM0__dii__resolve) {
+        return;
+    }
+    second = &BM0__get_program_instructions(program)[first->p_next_index];
+    third = &BM0__get_program_instructions(program)[second->p_next_index];
+
+    // find sequence, only the last instruction may write the instruction pointer
+    if (first->p_type >= BM0__dit__operate__comparison__less_than && first->p_type <= BM0__dit__operate__comparison__greater_than && ((first->p_type - BM0__dit__operate__binary__right_shift) & 1) == 0 && first->p_parameters[5] != BM0__rt__instruction_pointer_register && second->p_type == BM0__dit__write_register && second->p_parameters[0] != BM0__rt__instruction_pointer_register && third->p_type == BM0__dit__operate__integer__add__flag_bit && third->p_parameters[0] == first->p_parameters[5] && third->p_parameters[5] == BM0__rt__instruction_pointer_register) {
+        fused.p_type = BM0__dit__compare_and_branch;
+        fused.p_immediate = second->p_immediate;
+        fused.p_parameters[0] = (unsigned char)((first->p_type - BM0__dit__operate__binary__right_shift) / 2);
+        fused.p_parameters[1] = first->p_parameters[3];
+        fused.p_parameters[2] = first->p_parameters[4];
+        fused.p_parameters[3] = first->p_parameters[5];
+        fused.p_parameters[4] = third->p_parameters[1];
+        fused.p_parameters[5] = third->p_parameters[3];
+        fused.p_parameters[6] = third->p_parameters[4];
+        fused.p_parameters[7] = second->p_parameters[0];
+        last = third;
+    } else if (first->p_type == BM0__dit__operate__integer__add && first->p_parameters[5] != BM0__rt__instruction_pointer_register && second->p_type == BM0__dit__buffer_to_register && second->p_parameters[0] == first->p_parameters[5] && second->p_parameters[2] != BM0__rt__instruction_pointer_register) {
+        fused.p_type = BM0__dit__load_indexed;
+        fused.p_parameters[0] = first->p_parameters[3];
+        fused.p_parameters[1] = first->p_parameters[4];
+        fused.p_parameters[2] = first->p_parameters[5];
+        fused.p_parameters[3] = second->p_parameters[1];
+        fused.p_parameters[4] = second->p_parameters[2];
+        last = second;
+    } else if (first->p_type == BM0__dit__write_register && first->p_parameters[0] != BM0__rt__instruction_pointer_register && (second->p_type == BM0__dit__operate__integer__add || second->p_type == BM0__dit__operate__integer__add__flag_bit) && (second->p_parameters[3] == first->p_parameters[0] || second->p_parameters[4] == first->p_parameters[0])) {
+        fused.p_type = BM0__dit__add_immediate;
+        fused.p_operate_mode = second->p_operate_mode;
+        fused.p_parameters[0] = first->p_parameters[0];
+        fused.p_parameters[1] = second->p_parameters[0];
+        fused.p_parameters[2] = second->p_parameters[1];
+        fused.p_parameters[3] = second->p_parameters[3];
+        fused.p_parameters[4] = second->p_parameters[4];
+        fused.p_parameters[5] = second->p_parameters[5];
+        last = second;
+    }
+    if (last == 0) {
+        return;
+    }
+
+    // replace first instruction, the others stay decoded for jumps into the middle
+    fused.p_length = (unsigned char)(last->p_next_instruction_pointer - (first->p_next_instruction_pointer - first->p_length));
+    fused.p_next_instruction_pointer = last->p_next_instruction_pointer;
+    *first = fused;
+    BM0__link_decoded_instruction(program, index);
+
+    return;
+}
+
+// fuses common sequences of the already decoded instructions into superinstructions, results stay identical to BM0__run_byte_machine
+// instructions decoded later are not fused, and invalidating any byte of a superinstruction splits it back up
+// compiled blocks end at superinstructions, so programs meant for the JIT are better left unoptimized
+void BM0__optimize_program(BM0__program* program) {
+#ifdef BM0__enable__jit
+    if (program->p_jit != 0) {
+        BM0__reset_jit(program->p_jit);
+    }
+#endif
+
+    for (unsigned long long offset = 0; offset < program->p_code.p_length; offset++) {
+        if (BM0__get_program_offset_map(program)[offset] != 0) {
+            BM0__fuse_decoded_instruction(program, BM0__get_program_offset_map(program)[offset] - 1);
+        }
+    }
+
+    return;
+}
+
+/* Decoded Programs - Files */
+// program file header, followed by the code, offset map, decoded instructions and JIT heat, each starting at a multiple of BM0__define__program_file_alignment
+// decoded instructions hold their next instruction pointer as an offset into the code
+typedef struct BM0__program_file_header {
+    unsigned char p_magic[8]; // "BM0PROG"
+    unsigned long long p_version; // BM0__define__program_file_version
+    unsigned long long p_file_length;
+    unsigned long long p_content_hash; // BM0__hash_bytes of everything after the header, so damaged tables are caught along with damaged code
+    unsigned long long p_code_offset;
+    unsigned long long p_code_length;
+    unsigned long long p_offset_map_offset;
+    unsigned long long p_instructions_offset;
+    unsigned long long p_instruction_count;
+    unsigned long long p_jit_heat_offset; // zero when the program had no JIT
+} BM0__program_file_header;
+
+unsigned long long BM0__align_program_file_offset(unsigned long long offset) {
+    return (offset + BM0__define__program_file_alignment - 1) & ~((unsigned long long)BM0__define__program_file_alignment - 1);
+}
+
+// checks that a header belongs to this version and that every section fits inside the file
+BM0__boolean BM0__check_program_file_header(BM0__program_file_header* header, unsigned long long file_length) {
+    if (BM0__compare_bytes((*header).p_magic, "BM0PROG", sizeof((*header).p_magic)) != sizeof((*header).p_magic) || (*header).p_version != BM0__define__program_file_version || (*header).p_file_length != file_length) {
+        return BM0__boolean__false;
+    }
+    if ((*header).p_code_length >= file_length || (*header).p_instruction_count >= file_length || (*header).p_instruction_count < BM0__dii__RESERVED_COUNT) {
+        return BM0__boolean__false;
+    }
+    if ((*header).p_code_offset < sizeof(BM0__program_file_header) || (*header).p_code_offset % BM0__define__program_file_alignment != 0 || (*header).p_code_offset + (*header).p_code_length > file_length) {
+        return BM0__boolean__false;
+    }
+    if ((*header).p_offset_map_offset % BM0__define__program_file_alignment != 0 || (*header).p_offset_map_offset + (((*header).p_code_length + 1) * sizeof(unsigned int)) > file_length) {
+        return BM0__boolean__false;
+    }
+    if ((*header).p_instructions_offset % BM0__define__program_file_alignment != 0 || (*header).p_instructions_offset + ((*header).p_instruction_count * sizeof(BM0__decoded_instruction)) > file_length) {
+        return BM0__boolean__false;
+    }
+    if ((*header).p_jit_heat_offset != 0 && ((*header).p_jit_heat_offset % BM0__define__program_file_alignment != 0 || (*header).p_jit_heat_offset + (*header).p_instruction_count > file_length)) {
+        return BM0__boolean__false;
+    }
+
+    return BM0__boolean__true;
+}
+
+// writes a decoded program, its superinstructions and which of its blocks were compiled to a file that BM0__load_program maps back in
+// the file is written next to the path and renamed over it, so processes loading it never see half of one
+void BM0__save_program(BM0__et* error, BM0__program* program, char* path) {
+    BM0__program_file_header header;
+    BM0__buffer file;
+    BM0__decoded_instruction* instructions;
+    char temporary_path[4096];
+    unsigned long long written = 0;
+    long long result;
+    int file_descriptor;
+
+    // lay out sections
+    BM0__copy_bytes("BM0PROG", sizeof(header.p_magic), header.p_magic);
+    header.p_version = BM0__define__program_file_version;
+    header.p_code_offset = BM0__align_program_file_offset(sizeof(BM0__program_file_header));
+    header.p_code_length = program->p_code.p_length;
+    header.p_offset_map_offset = BM0__align_program_file_offset(header.p_code_offset + header.p_code_length);
+    header.p_instructions_offset = BM0__align_program_file_offset(header.p_offset_map_offset + ((header.p_code_length + 1) * sizeof(unsigned int)));
+    header.p_instruction_count = program->p_instruction_count;
+    header.p_jit_heat_offset = 0;
+    header.p_file_length = BM0__align_program_file_offset(header.p_instructions_offset + (header.p_instruction_count * sizeof(BM0__decoded_instruction)));
+#ifdef BM0__enable__jit
+    if (program->p_jit != 0) {
+        header.p_jit_heat_offset = header.p_file_length;
+        header.p_file_length = BM0__align_program_file_offset(header.p_jit_heat_offset + header.p_instruction_count);
+    }
+#endif
+
+    // fill sections
+    file = BM0__create_buffer(error, header.p_file_length);
+    if (*error != BM0__et__no_error) {
+        return;
+    }
+    BM0__copy_bytes(&header, sizeof(BM0__program_file_header), file.p_data);
+    BM0__copy_bytes(program->p_code.p_data, header.p_code_length, file.p_data + header.p_code_offset);
+    BM0__copy_bytes(program->p_offset_map.p_data, (header.p_code_length + 1) * sizeof(unsigned int), file.p_data + header.p_offset_map_offset);
+    BM0__copy_bytes(program->p_instructions.p_data, header.p_instruction_count * sizeof(BM0__decoded_instruction), file.p_data + header.p_instructions_offset);
+    instructions = (BM0__decoded_instruction*)(file.p_data + header.p_instructions_offset);
+    for (unsigned long long i = 0; i < header.p_instruction_count; i++) {
+        if (instructions[i].p_length != 0) {
+            instructions[i].p_next_instruction_pointer = (void*)(instructions[i].p_next_instruction_pointer - program->p_code.p_data);
+        } else {
+            instructions[i].p_next_instruction_pointer = 0;
+        }
+    }
+#ifdef BM0__enable__jit
+    if (program->p_jit != 0) {
+        BM0__copy_bytes(program->p_jit->p_heat.p_data, header.p_instruction_count < program->p_jit->p_heat.p_length ? header.p_instruction_count : program->p_jit->p_heat.p_length, file.p_data + header.p_jit_heat_offset);
+    }
+#endif
+    header.p_content_hash = BM0__hash_bytes(file.p_data + header.p_code_offset, header.p_file_length - header.p_code_offset);
+    BM0__copy_bytes(&header.p_content_hash, sizeof(unsigned long long), &((BM0__program_file_header*)file.p_data)->p_content_hash);
+
+    // write file, under a unique name so threads and processes saving the same path never share one
+    if (snprintf(temporary_path, sizeof(temporary_path), "%s.XXXXXX", path) >= (int)sizeof(temporary_path)) {
+        *error = BM0__et__program_file_unavailable;
+        BM0__destroy_buffer(file);
+
+        return;
+    }
+    file_descriptor = mkstemp(temporary_path);
+    if (file_descriptor >= 0 && fchmod(file_descriptor, 0644) != 0) {
+        close(file_descriptor);
+        unlink(temporary_path);
+        file_descriptor = -1;
+    }
+    if (file_descriptor < 0) {
+        *error = BM0__et__program_file_unavailable;
+        BM0__destroy_buffer(file);
+
+        return;
+    }
+    while (written < file.p_length) {
+        result = write(file_descriptor, file.p_data + written, file.p_length - written);
+        if (result <= 0) {
+            break;
+        }
+        written += (unsigned long long)result;
+    }
+    if (close(file_descriptor) != 0 || written != file.p_length || rename(temporary_path, path) != 0) {
+        *error = BM0__et__program_file_unavailable;
+        unlink(temporary_path);
+    }
+    BM0__destroy_buffer(file);
+
+    return;
+}
+
+// maps a file made by BM0__save_program back in as a decoded program, its code is program.p_code which must be used as input buffer 0
+// nothing is decoded again, loading only checks the code and tables against their hash and bounds and turns next instruction offsets back into pointers
+// the mapping is private, so programs writing into themselves do not change the file
+BM0__program BM0__load_program(BM0__et* error, char* path) {
+    BM0__program output;
+    BM0__program_file_header* header;
+    BM0__decoded_instruction* instructions;
+    struct stat file_stats;
+    void* file;
+    int file_descriptor;
+
+    // setup blank program
+    output.p_code = BM0__create_null_buffer();
+    output.p_offset_map = BM0__create_null_buffer();
+    output.p_instructions = BM0__create_null_buffer();
+    output.p_instruction_count = 0;
+    output.p_jit = 0;
+    output.p_file = BM0__create_null_buffer();
+
+    // map file
+    file_descriptor = open(path, O_RDONLY);
+    if (file_descriptor < 0) {
+        *error = BM0__et__program_file_unavailable;
+
+        return output;
+    }
+    if (fstat(file_descriptor, &file_stats) != 0 || (unsigned long long)file_stats.st_size < sizeof(BM0__program_file_header)) {
+        *error = BM0__et__invalid_program_file;
+        close(file_descriptor);
+
+        return output;
+    }
+    file = mmap(0, (unsigned long long)file_stats.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    if (file == MAP_FAILED) {
+        *error = BM0__et__program_file_unavailable;
+
+        return output;
+    }
+    header = (BM0__program_file_header*)file;
+    if (BM0__check_program_file_header(header, (unsigned long long)file_stats.st_size) == BM0__boolean__false || BM0__hash_bytes(file + (*header).p_code_offset, (*header).p_file_length - (*header).p_code_offset) != (*header).p_content_hash) {
+        *error = BM0__et__invalid_program_file;
+        BM0__deallocate(file, (unsigned long long)file_stats.st_size);
+
+        return output;
+    }
+
+    // rebase next instruction pointers, anything that could send the engine outside of the tables makes the file invalid
+    instructions = (BM0__decoded_instruction*)(file + (*header).p_instructions_offset);
+    for (unsigned long long i = 0; i < (*header).p_instruction_count; i++) {
+        if (instructions[i].p_type > BM0__dit__hash_table_operate || instructions[i].p_next_index >= (*header).p_instruction_count || instructions[i].p_length > BM0__define__max_superinstruction_length || (unsigned long long)instructions[i].p_next_instruction_pointer > (*header).p_code_length) {
+            *error = BM0__et__invalid_program_file;
+            BM0__deallocate(file, (unsigned long long)file_stats.st_size);
+
+            return output;
+        }
+        instructions[i].p_next_instruction_pointer = file + (*header).p_code_offset + (unsigned long long)instructions[i].p_next_instruction_pointer;
+    }
+    for (unsigned long long i = 0; i <= (*header).p_code_length; i++) {
+        if (((unsigned int*)(file + (*header).p_offset_map_offset))[i] > (*header).p_instruction_count) {
+            *error = BM0__et__invalid_program_file;
+            BM0__deallocate(file, (unsigned long long)file_stats.st_size);
+
+            return output;
+        }
+    }
+
+    // setup program
+    output.p_file.p_data = file;
+    output.p_file.p_length = (unsigned long long)file_stats.st_size;
+    output.p_code.p_data = file + (*header).p_code_offset;
+    output.p_code.p_length = (*header).p_code_length;
+    output.p_offset_map.p_data = file + (*header).p_offset_map_offset;
+    output.p_offset_map.p_length = ((*header).p_code_length + 1) * sizeof(unsigned int);
+    output.p_instructions.p_data = instructions;
+    output.p_instructions.p_length = (*header).p_instruction_count * sizeof(BM0__decoded_instruction);
+    output.p_instruction_count = (*header).p_instruction_count;
+
+#ifdef BM0__enable__jit
+    // blocks that were hot when the program was saved are compiled the first time they are entered
+    if ((*header).p_jit_heat_offset != 0) {
+        BM0__attach_jit_to_program(error, &output);
+        if (*error == BM0__et__no_error) {
+            BM0__copy_bytes(file + (*header).p_jit_heat_offset, output.p_instruction_count, output.p_jit->p_heat.p_data);
+        }
+    }
+#endif
+
+    return output;
+}
+
+// handler plumbing shared by the threaded and switch dispatch cores
+#ifdef BM0__enable__threaded_dispatch
+#define BM0__decoded_engine__handler(type) BM0__decoded_engine__handler__##type:
+#define BM0__decoded_engine__dispatch() { \
+    if (budget == 0) { \
+        goto BM0__decoded_engine__yield; \
+    } \
+    budget--; \
+    BM0__decoded_engine__profile(); \
+    BM0__decoded_engine__trace(); \
+    parameters = instruction->p_parameters; \
+    goto *handlers[instruction->p_type]; \
+}
+#else
+#define BM0__decoded_engine__handler(type) case BM0__dit__##type:
+#define BM0__decoded_engine__dispatch() { continue; }
+#endif
+
+// resolving is not an instruction of its own, the instruction it finds is profiled when it is dispatched
+#ifdef BM0__enable__profiler
+#define BM0__decoded_engine__profile() { \
+    if (profile != 0 && instruction->p_type != BM0__dit__resolve) { \
+        BM0__profile_instruction(profile, regs); \
+    } \
+}
+#else
+#define BM0__decoded_engine__profile()
+#endif
+
+// traced the same way as profiled, the entry of the instruction that ran last is finished by the next one or by the context
+#ifdef BM0__enable__trace
+#define BM0__decoded_engine__trace() { \
+    if (trace != 0 && instruction->p_type != BM0__dit__resolve) { \
+        BM0__trace_instruction(trace, regs); \
+    } \
+}
+#else
+#define BM0__decoded_engine__trace()
+#endif
+
+// profiled or traced runs must see every instruction on its own
+#if defined(BM0__enable__profiler) && defined(BM0__enable__trace)
+#define BM0__decoded_engine__observed() (profile != 0 || trace != 0)
+#elif defined(BM0__enable__profiler)
+#define BM0__decoded_engine__observed() (profile != 0)
+#elif defined(BM0__enable__trace)
+#define BM0__decoded_engine__observed() (trace != 0)
+#else
+#define BM0__decoded_engine__observed() (0)
+#endif
+
+// jumps go through compiled blocks first when the program has any
+#ifdef BM0__enable__jit
+#define BM0__decoded_engine__jump(index) { \
+    instruction_index = (index); \
+    goto BM0__decoded_engine__enter; \
+}
+#else
+#define BM0__decoded_engine__jump(index) { \
+    instruction_index = (index); \
+    instructions = BM0__get_program_instructions(program); \
+    instruction = &instructions[instruction_index]; \
+    BM0__decoded_engine__dispatch(); \
+}
+#endif
+
+// hands the running instruction to the reference engine without dispatching it again, so it is only budgeted, profiled and traced once
+#define BM0__decoded_engine__fall_back() { \
+    goto BM0__decoded_engine__reference; \
+}
+
+// jumps are writes to the instruction pointer and still get the instruction length added
+#define BM0__decoded_engine__advance() BM0__decoded_engine__advance_last(instruction->p_length)
+
+// same as above for the last instruction of a superinstruction, the instruction pointer must already point at it
+#define BM0__decoded_engine__advance_last(length) { \
+    if (regs[BM0__rt__instruction_pointer_register] == instruction->p_next_instruction_pointer - (length)) { \
+        regs[BM0__rt__instruction_pointer_register] = instruction->p_next_instruction_pointer; \
+        instruction = &instructions[instruction->p_next_index]; \
+        BM0__decoded_engine__dispatch(); \
+    } \
+    BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], (length)); \
+    BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register])); \
+}
+
+// a superinstruction takes the rest of its instructions out of the budget, or runs only its first one when the budget cannot cover them or every instruction must be seen
+#define BM0__decoded_engine__fuse(count) { \
+    if (budget < (count) - 1 || BM0__decoded_engine__observed()) { \
+        BM0__decoded_engine__fall_back(); \
+    } \
+    budget -= (count) - 1; \
+}
+
+// an operation handler and its flag bit checking twin, b is unused by not
+#define BM0__decoded_engine__operate(type, expression) \
+    BM0__decoded_engine__handler(operate__##type) { \
+        unsigned long long a = (unsigned long long)regs[parameters[3]]; \
+        unsigned long long b = (unsigned long long)regs[parameters[4]]; \
+        regs[parameters[5]] = (void*)(unsigned long long)(expression); \
+        (void)b; \
+        BM0__decoded_engine__advance(); \
+    } \
+    BM0__decoded_engine__handler(operate__##type##__flag_bit) { \
+        if (((unsigned long long)regs[parameters[0]] & instruction->p_immediate) > 0) { \
+            unsigned long long a = (unsigned long long)regs[parameters[3]]; \
+            unsigned long long b = (unsigned long long)regs[parameters[4]]; \
+            regs[parameters[5]] = (void*)(unsigned long long)(expression); \
+            (void)b; \
+        } \
+        BM0__decoded_engine__advance(); \
+    }
+
+// same as above for operations that report an error when the second source is zero
+#define BM0__decoded_engine__operate_nonzero(type, expression, zero_error) \
+    BM0__decoded_engine__handler(operate__##type) { \
+        unsigned long long a = (unsigned long long)regs[parameters[3]]; \
+        unsigned long long b = (unsigned long long)regs[parameters[4]]; \
+        if (b != 0) { \
+            regs[parameters[5]] = (void*)(unsigned long long)(expression); \
+        } else { \
+            regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)zero_error; \
+        } \
+        BM0__decoded_engine__advance(); \
+    } \
+    BM0__decoded_engine__handler(operate__##type##__flag_bit) { \
+        if (((unsigned long long)regs[parameters[0]] & instruction->p_immediate) > 0) { \
+            unsigned long long a = (unsigned long long)regs[parameters[3]]; \
+            unsigned long long b = (unsigned long long)regs[parameters[4]]; \
+            if (b != 0) { \
+                regs[parameters[5]] = (void*)(unsigned long long)(expression); \
+            } else { \
+                regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]] = (void*)(unsigned long long)(unsigned short)zero_error; \
+            } \
+        } \
+        BM0__decoded_engine__advance(); \
+    }
+
+// runs a decoded program on registers set up by BM0__prepare_byte_machine until it quits or has run out of its instruction budget
+// returns false once the machine has quit or hit a critical error, the allocation table is left as the program left it
+BM0__boolean BM0__run_decoded_program(BM0__et* error, BM0__program* program, void** regs, BM0__vector* vectors, BM0__allocations* allocations, unsigned long long* instruction_budget, BM0__buffer* output, BM0__boolean final_debug_info) {
+    // instructions left to run, kept local so dispatching does not go through memory
+    unsigned long long budget = *instruction_budget;
+#ifdef BM0__enable__profiler
+    BM0__profile* profile = (*allocations).p_profile;
+#endif
+#ifdef BM0__enable__trace
+    BM0__trace* trace = (*allocations).p_trace;
+#endif
+
+    // current instruction
+    BM0__decoded_instruction* instructions;
+    BM0__decoded_instruction* instruction;
+    unsigned long long instruction_index;
+    unsigned char* parameters;
+    void* write_address;
+    unsigned long long write_length;
+
+#ifdef BM0__enable__threaded_dispatch
+    // handler addresses in BM0__dit order
+    static void* handlers[] = {
+        &&BM0__decoded_engine__handler__resolve,
+        &&BM0__decoded_engine__handler__reference,
+        &&BM0__decoded_engine__handler__write_register,
+        &&BM0__decoded_engine__handler__allocate,
+        &&BM0__decoded_engine__handler__deallocate,
+        &&BM0__decoded_engine__handler__buffer_to_register,
+        &&BM0__decoded_engine__handler__register_to_register,
+        &&BM0__decoded_engine__handler__register_to_buffer,
+        &&BM0__decoded_engine__handler__operate,
+        &&BM0__decoded_engine__handler__do_x86_64_linux_syscall_limited,
+        &&BM0__decoded_engine__handler__buffer_to_buffer,
+        &&BM0__decoded_engine__handler__fill_buffer,
+        &&BM0__decoded_engine__handler__compare_buffers,
+        &&BM0__decoded_engine__handler__buffer_to_vector,
+        &&BM0__decoded_engine__handler__vector_to_buffer,
+        &&BM0__decoded_engine__handler__register_to_vector,
+        &&BM0__decoded_engine__handler__vector_operate,
+        &&BM0__decoded_engine__handler__reduce_vector,
+        &&BM0__decoded_engine__handler__submit_io,
+        &&BM0__decoded_engine__handler__complete_io,
+        &&BM0__decoded_engine__handler__operate__binary__right_shift,
+        &&BM0__decoded_engine__handler__operate__binary__right_shift__flag_bit,
+        &&BM0__decoded_engine__handler__operate__binary__left_shift,
+        &&BM0__decoded_engine__handler__operate__binary__left_shift__flag_bit,
+        &&BM0__decoded_engine__handler__operate__binary__not,
+        &&BM0__decoded_engine__handler__operate__binary__not__flag_bit,
+        &&BM0__decoded_engine__handler__operate__binary__and,
+        &&BM0__decoded_engine__handler__operate__binary__and__flag_bit,
+        &&BM0__decoded_engine__handler__operate__binary__or,
+        &&BM0__decoded_engine__handler__operate__binary__or__flag_bit,
+        &&BM0__decoded_engine__handler__operate__binary__xor,
+        &&BM0__decoded_engine__handler__operate__binary__xor__flag_bit,
+        &&BM0__decoded_engine__handler__operate__integer__add,
+        &&BM0__decoded_engine__handler__operate__integer__add__flag_bit,
+        &&BM0__decoded_engine__handler__operate__integer__subtract,
+        &&BM0__decoded_engine__handler__operate__integer__subtract__flag_bit,
+        &&BM0__decoded_engine__handler__operate__integer__multiply,
+        &&BM0__decoded_engine__handler__operate__integer__multiply__flag_bit,
+        &&BM0__decoded_engine__handler__operate__integer__divide,
+        &&BM0__decoded_engine__handler__operate__integer__divide__flag_bit,
+        &&BM0__decoded_engine__handler__operate__integer__modulous,
+        &&BM0__decoded_engine__handler__operate__integer__modulous__flag_bit,
+        &&BM0__decoded_engine__handler__operate__comparison__less_than,
+        &&BM0__decoded_engine__handler__operate__comparison__less_than__flag_bit,
+        &&BM0__decoded_engine__handler__operate__comparison__equal_to,
+        &&BM0__decoded_engine__handler__operate__comparison__equal_to__flag_bit,
+        &&BM0__decoded_engine__handler__operate__comparison__not_equal_to,
+        &&BM0__decoded_engine__handler__operate__comparison__not_equal_to__flag_bit,
+        &&BM0__decoded_engine__handler__operate__comparison__greater_than,
+        &&BM0__decoded_engine__handler__operate__comparison__greater_than__flag_bit,
+        &&BM0__decoded_engine__handler__load_indexed,
+        &&BM0__decoded_engine__handler__add_immediate,
+        &&BM0__decoded_engine__handler__compare_and_branch,
+        &&BM0__decoded_engine__handler__send_to_channel,
+        &&BM0__decoded_engine__handler__receive_from_channel,
+        &&BM0__decoded_engine__handler__atomic_operate,
+        &&BM0__decoded_engine__handler__allocate_with_policy,
+        &&BM0__decoded_engine__handler__hash_table_operate
+    };
+#endif
+
+    // process instructions
+    instruction_index = BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]);
+#ifdef BM0__enable__jit
+BM0__decoded_engine__enter:
+    // compiled blocks cannot be profiled or traced
+    if (program->p_jit != 0 && !BM0__decoded_engine__observed()) {
+        program->p_jit->p_budget = budget;
+        instruction_index = BM0__run_jit_blocks(program, regs, instruction_index);
+        budget = program->p_jit->p_budget;
+    }
+#endif
+    instructions = BM0__get_program_instructions(program);
+    instruction = &instructions[instruction_index];
+#ifdef BM0__enable__threaded_dispatch
+    BM0__decoded_engine__dispatch();
+#else
+    while (BM0__boolean__true) {
+        if (budget == 0) {
+            goto BM0__decoded_engine__yield;
+        }
+        budget--;
+        BM0__decoded_engine__profile();
+        BM0__decoded_engine__trace();
+        parameters = instruction->p_parameters;
+
+        switch ((BM0__dit)instruction->p_type) {
+#endif
+        BM0__decoded_engine__handler(resolve) {
+            // finding the instruction does not count against the budget
+            budget++;
+
+            BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+        }
+        BM0__decoded_engine__handler(reference) {
+BM0__decoded_engine__reference:
+            if (BM0__step_byte_machine(error, regs, vectors, allocations, output, final_debug_info) == BM0__boolean__false) {
+#ifdef BM0__enable__profiler
+                if (profile != 0) {
+                    BM0__stop_profiling_instruction(profile);
+                }
+#endif
+                *instruction_budget = budget;
+
+                return BM0__boolean__false;
+            }
+
+            BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+        }
+        BM0__decoded_engine__handler(write_register) {
+            regs[parameters[0]] = (void*)instruction->p_immediate;
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(allocate) {
+            // errors landing in the parameter registers change what the reference engine does next
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__lock_allocations(allocations);
+            regs[parameters[1]] = (void*)BM0__allocate_buffer_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[parameters[0]], (*allocations).p_policy);
+            if (regs[parameters[1]] < (void*)(*allocations).p_slot_count) {
+                regs[parameters[2]] = (*allocations).p_buffers[(unsigned long long)regs[parameters[1]]].p_data;
+                regs[parameters[3]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[parameters[1]]].p_length);
+            } else {
+                regs[parameters[2]] = 0;
+                regs[parameters[3]] = 0;
+            }
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(deallocate) {
+            BM0__lock_allocations(allocations);
+            BM0__deallocate_buffer_from_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[parameters[0]]);
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(buffer_to_register) {
+            // the transfer size was checked when decoding
+            if (parameters[1] == sizeof(unsigned long long)) {
+                __builtin_memcpy((void*)&regs[parameters[2]], regs[parameters[0]], sizeof(unsigned long long));
+            } else {
+                BM0__copy_bytes(regs[parameters[0]], parameters[1], (void*)&regs[parameters[2]]);
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(register_to_register) {
+            regs[parameters[1]] = regs[parameters[0]];
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(register_to_buffer) {
+            // same as above
+            if (parameters[1] == sizeof(unsigned long long)) {
+                __builtin_memcpy(regs[parameters[2]], (void*)&regs[parameters[0]], sizeof(unsigned long long));
+            } else {
+                BM0__copy_bytes((void*)&regs[parameters[0]], parameters[1], regs[parameters[2]]);
+            }
+
+            // self modifying code, the instruction may have just been re-decoded so advance by its known length
+            if (BM0__check_program_overlap(program, regs[parameters[2]], parameters[1])) {
+                BM0__invalidate_program_write(program, regs[parameters[2]], parameters[1]);
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__register_to_buffer);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(operate) {
+            // operations read from a register and invalid operations, the reference engine reports invalid ones
+            switch ((BM0__omt)instruction->p_operate_mode) {
+            case BM0__omt__flag_bit__direct_operation:
+                if (((unsigned long long)regs[parameters[0]] & instruction->p_immediate) > 0 && BM0__perform_operation(regs, parameters[2], parameters[3], parameters[4], parameters[5]) == BM0__boolean__false) {
+                    BM0__decoded_engine__fall_back();
+                }
+
+                break;
+            case BM0__omt__flag_bit__register_operation:
+                if (((unsigned long long)regs[parameters[0]] & instruction->p_immediate) > 0 && BM0__perform_operation(regs, (unsigned short)(unsigned long long)regs[parameters[2]], parameters[3], parameters[4], parameters[5]) == BM0__boolean__false) {
+                    BM0__decoded_engine__fall_back();
+                }
+
+                break;
+            case BM0__omt__always__direct_operation:
+                if (BM0__perform_operation(regs, parameters[2], parameters[3], parameters[4], parameters[5]) == BM0__boolean__false) {
+                    BM0__decoded_engine__fall_back();
+                }
+
+                break;
+            case BM0__omt__always__register_operation:
+                if (BM0__perform_operation(regs, (unsigned short)(unsigned long long)regs[parameters[2]], parameters[3], parameters[4], parameters[5]) == BM0__boolean__false) {
+                    BM0__decoded_engine__fall_back();
+                }
+
+                break;
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(do_x86_64_linux_syscall_limited) {
+            // errors landing in the parameter registers change what the reference engine does next
+            if (parameters[0] >= BM0__st__mmap && BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            // self modifying code through a read, the instruction may be re-decoded so advance by its known length
+            if (BM0__get_syscall_write_range(regs, parameters[0], parameters[1], parameters[2], parameters[3], &write_address, &write_length) && BM0__check_program_overlap(program, write_address, write_length)) {
+                BM0__perform_syscall(regs, allocations, parameters[0], parameters[1], parameters[2], parameters[3], parameters[4], parameters[5], parameters[6], parameters[7]);
+                BM0__invalidate_program_write(program, write_address, write_length);
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__do_x86_64_linux_syscall_limited);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__perform_syscall(regs, allocations, parameters[0], parameters[1], parameters[2], parameters[3], parameters[4], parameters[5], parameters[6], parameters[7]);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(buffer_to_buffer) {
+            BM0__move_bytes(regs[parameters[0]], (unsigned long long)regs[parameters[1]], regs[parameters[2]]);
+
+            // self modifying code, the instruction may have just been re-decoded so advance by its known length
+            if (BM0__check_program_overlap(program, regs[parameters[2]], (unsigned long long)regs[parameters[1]])) {
+                BM0__invalidate_program_write(program, regs[parameters[2]], (unsigned long long)regs[parameters[1]]);
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__buffer_to_buffer);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(fill_buffer) {
+            BM0__fill_bytes(regs[parameters[2]], (unsigned long long)regs[parameters[1]], (unsigned char)(unsigned long long)regs[parameters[0]]);
+
+            // self modifying code, same as above
+            if (BM0__check_program_overlap(program, regs[parameters[2]], (unsigned long long)regs[parameters[1]])) {
+                BM0__invalidate_program_write(program, regs[parameters[2]], (unsigned long long)regs[parameters[1]]);
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__fill_buffer);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(compare_buffers) {
+            regs[parameters[3]] = (void*)BM0__compare_bytes(regs[parameters[0]], regs[parameters[1]], (unsigned long long)regs[parameters[2]]);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(buffer_to_vector) {
+            __builtin_memcpy(&vectors[parameters[1]], regs[parameters[0]], BM0__define__vector_register_length);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(vector_to_buffer) {
+            __builtin_memcpy(regs[parameters[1]], &vectors[parameters[0]], BM0__define__vector_register_length);
+
+            // self modifying code, same as register to buffer
+            if (BM0__check_program_overlap(program, regs[parameters[1]], BM0__define__vector_register_length)) {
+                BM0__invalidate_program_write(program, regs[parameters[1]], BM0__define__vector_register_length);
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__vector_to_buffer);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(register_to_vector) {
+            // the reference engine reports invalid lane types
+            if (BM0__broadcast_to_vector(vectors, parameters[0], (unsigned long long)regs[parameters[1]], parameters[2]) == BM0__boolean__false) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(vector_operate) {
+            // the reference engine reports invalid operations and lane types
+            if ((instruction->p_operate_mode >= BM0__omt__always__direct_operation || ((unsigned long long)regs[parameters[0]] & instruction->p_immediate) > 0) && BM0__perform_vector_operation(vectors, (instruction->p_operate_mode == BM0__omt__flag_bit__direct_operation || instruction->p_operate_mode == BM0__omt__always__direct_operation) ? parameters[2] : (unsigned short)(unsigned long long)regs[parameters[2]], parameters[3], parameters[4], parameters[5], parameters[6]) == BM0__boolean__false) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(reduce_vector) {
+            // same as above
+            if (BM0__perform_vector_reduction(regs, vectors, parameters[0], parameters[1], parameters[2], parameters[3]) == BM0__boolean__false) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(submit_io) {
+            // errors landing in the parameter registers change what the reference engine does next
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__lock_allocations(allocations);
+            regs[parameters[2]] = (void*)BM0__submit_io_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (BM0__io_request*)regs[parameters[0]], (unsigned long long)regs[parameters[1]]);
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(complete_io) {
+            BM0__lock_allocations(allocations);
+            regs[parameters[3]] = (void*)BM0__complete_io_from_allocations(allocations, (BM0__io_completion*)regs[parameters[0]], (unsigned long long)regs[parameters[1]], (unsigned long long)regs[parameters[2]]);
+            BM0__unlock_allocations(allocations);
+
+            // self modifying code through finished reads, the instruction may be re-decoded so advance by its known length
+            if ((*allocations).p_io_queue != 0 && BM0__check_program_overlap(program, (*(*allocations).p_io_queue).p_last_read_start, (unsigned long long)((*(*allocations).p_io_queue).p_last_read_end - (*(*allocations).p_io_queue).p_last_read_start))) {
+                BM0__invalidate_program_write(program, (*(*allocations).p_io_queue).p_last_read_start, (unsigned long long)((*(*allocations).p_io_queue).p_last_read_end - (*(*allocations).p_io_queue).p_last_read_start));
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__complete_io);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__operate(binary__right_shift, a >> b)
+        BM0__decoded_engine__operate(binary__left_shift, a << b)
+        BM0__decoded_engine__operate(binary__not, ~a)
+        BM0__decoded_engine__operate(binary__and, a & b)
+        BM0__decoded_engine__operate(binary__or, a | b)
+        BM0__decoded_engine__operate(binary__xor, a ^ b)
+        BM0__decoded_engine__operate(integer__add, a + b)
+        BM0__decoded_engine__operate(integer__subtract, a - b)
+        BM0__decoded_engine__operate(integer__multiply, a * b)
+        BM0__decoded_engine__operate_nonzero(integer__divide, a / b, BM0__et__division_by_zero_attempted)
+        BM0__decoded_engine__operate_nonzero(integer__modulous, a % b, BM0__et__modulus_by_zero_attempted)
+        BM0__decoded_engine__operate(comparison__less_than, a < b)
+        BM0__decoded_engine__operate(comparison__equal_to, a == b)
+        BM0__decoded_engine__operate(comparison__not_equal_to, a != b)
+        BM0__decoded_engine__operate(comparison__greater_than, a > b)
+        BM0__decoded_engine__handler(load_indexed) {
+            BM0__decoded_engine__fuse(2);
+
+            regs[parameters[2]] = (void*)((unsigned long long)regs[parameters[0]] + (unsigned long long)regs[parameters[1]]);
+            if (parameters[3] == sizeof(unsigned long long)) {
+                __builtin_memcpy((void*)&regs[parameters[4]], regs[parameters[2]], sizeof(unsigned long long));
+            } else {
+                BM0__copy_bytes(regs[parameters[2]], parameters[3], (void*)&regs[parameters[4]]);
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(add_immediate) {
+            BM0__decoded_engine__fuse(2);
+
+            // the operate instruction sees the instruction pointer at itself
+            regs[parameters[0]] = (void*)instruction->p_immediate;
+            regs[BM0__rt__instruction_pointer_register] = instruction->p_next_instruction_pointer - BM0__ilt__operate;
+            if (instruction->p_operate_mode == BM0__omt__always__direct_operation || ((unsigned long long)regs[parameters[1]] & BM0__get_operate_flag_mask(parameters[2])) > 0) {
+                regs[parameters[5]] = (void*)((unsigned long long)regs[parameters[3]] + (unsigned long long)regs[parameters[4]]);
+            }
+
+            BM0__decoded_engine__advance_last(BM0__ilt__operate);
+        }
+        BM0__decoded_engine__handler(compare_and_branch) {
+            BM0__decoded_engine__fuse(3);
+
+            // same as above
+            BM0__perform_operation(regs, parameters[0], parameters[1], parameters[2], parameters[3]);
+            regs[parameters[7]] = (void*)instruction->p_immediate;
+            regs[BM0__rt__instruction_pointer_register] = instruction->p_next_instruction_pointer - BM0__ilt__operate;
+            if (((unsigned long long)regs[parameters[3]] & BM0__get_operate_flag_mask(parameters[4])) > 0) {
+                regs[BM0__rt__instruction_pointer_register] = (void*)((unsigned long long)regs[parameters[5]] + (unsigned long long)regs[parameters[6]]);
+            }
+
+            BM0__decoded_engine__advance_last(BM0__ilt__operate);
+        }
+        BM0__decoded_engine__handler(send_to_channel) {
+            // errors landing in the parameter registers change what the reference engine does next
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__lock_allocations(allocations);
+            regs[parameters[2]] = (void*)(unsigned long long)BM0__send_allocation_to_channel((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[parameters[0]], (unsigned long long)regs[parameters[1]]);
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(receive_from_channel) {
+            // same as above
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__lock_allocations(allocations);
+            regs[parameters[1]] = (void*)BM0__receive_allocation_from_channel((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[parameters[0]]);
+            if (regs[parameters[1]] < (void*)(*allocations).p_slot_count) {
+                regs[parameters[2]] = (*allocations).p_buffers[(unsigned long long)regs[parameters[1]]].p_data;
+                regs[parameters[3]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[parameters[1]]].p_length);
+            } else {
+                regs[parameters[2]] = 0;
+                regs[parameters[3]] = 0;
+            }
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(atomic_operate) {
+            // same as above
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            // the operation was checked when decoding
+            // the destination register may be the pointer register
+            write_address = regs[parameters[1]];
+            BM0__perform_atomic_operation((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], regs, parameters[0], parameters[1], parameters[2], parameters[3], parameters[4]);
+
+            // same as above
+            if (parameters[0] != BM0__aot__load && parameters[0] != BM0__aot__fence && BM0__check_program_overlap(program, write_address, sizeof(unsigned long long))) {
+                BM0__invalidate_program_write(program, write_address, sizeof(unsigned long long));
+                BM0__change_void_pointer_in_place(&regs[BM0__rt__instruction_pointer_register], BM0__ilt__atomic_operate);
+
+                BM0__decoded_engine__jump(BM0__find_decoded_instruction(program, regs[BM0__rt__instruction_pointer_register]));
+            }
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(allocate_with_policy) {
+            // same as above
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            BM0__lock_allocations(allocations);
+            regs[parameters[2]] = (void*)BM0__allocate_buffer_to_allocations((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], allocations, (unsigned long long)regs[parameters[0]], (unsigned long long)regs[parameters[1]]);
+            if (regs[parameters[2]] < (void*)(*allocations).p_slot_count) {
+                regs[parameters[3]] = (*allocations).p_buffers[(unsigned long long)regs[parameters[2]]].p_data;
+                regs[parameters[4]] = (void*)((*allocations).p_buffers[(unsigned long long)regs[parameters[2]]].p_length);
+            } else {
+                regs[parameters[3]] = 0;
+                regs[parameters[4]] = 0;
+            }
+            BM0__unlock_allocations(allocations);
+
+            BM0__decoded_engine__advance();
+        }
+        BM0__decoded_engine__handler(hash_table_operate) {
+            // same as above
+            if (BM0__check_decoded_register_is_parameter_register((unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register])) {
+                BM0__decoded_engine__fall_back();
+            }
+
+            // the operation was checked when decoding
+            BM0__perform_hash_table_operation((BM0__et*)&regs[(unsigned char)(unsigned long long)regs[BM0__rt__instruction_error_code_register_register]], regs, allocations, parameters[0], parameters[1], parameters[2], parameters[3], parameters[4]);
+
+            BM0__decoded_engine__advance();
+        }
+#ifndef BM0__enable__threaded_dispatch
+        }
+    }
+#endif
+
+    // the instruction pointer always points at the next instruction to run, so the machine can be picked up from here
+BM0__decoded_engine__yield:
+#ifdef BM0__enable__profiler
+    if (profile != 0) {
+        BM0__stop_profiling_instruction(profile);
+    }
+#endif
+    *instruction_budget = 0;
+
+    return BM0__boolean__true;
+}
+
+// runs a program decoded by BM0__create_program, results are identical to BM0__run_byte_machine
+// allocations come from the arena when one is given, resetting it after a run frees everything the run allocated
+// at most max_allocation_count allocations can be live at once
+BM0__buffer BM0__run_decoded_byte_machine(BM0__et* error, BM0__buffer input_buffers_buffer, BM0__program* program, BM0__arena* arena, unsigned long long max_allocation_count, BM0__boolean final_debug_info) {
+    // output
+    BM0__buffer output = BM0__create_null_buffer();
+    unsigned long long instruction_budget = ~0ull;
+
+    // registers
+    void* regs[BM0__define__register_count];
+    BM0__vector vectors[BM0__define__vector_register_count];
+
+    // allocations
+    BM0__allocations* allocations = BM0__setup_byte_machine(error, input_buffers_buffer, regs, vectors, arena, max_allocation_count);
+
+    if (allocations == 0) {
+        return output;
+    }
+
+    // process instructions
+    while (BM0__run_decoded_program(error, program, regs, vectors, allocations, &instruction_budget, &output, final_debug_info)) {
+        instruction_budget = ~0ull;
+    }
+
+    // clean up
+    BM0__wait_for_siblings(allocations);
+    BM0__destroy_allocations(allocations);
+
+    return output;
+}
+
+#undef BM0__decoded_engine__handler
+#undef BM0__decoded_engine__profile
+#undef BM0__decoded_engine__trace
+#undef BM0__decoded_engine__dispatch
+#undef BM0__decoded_engine__jump
+#undef BM0__decoded_engine__fall_back
+#undef BM0__decoded_engine__observed
+#undef BM0__decoded_engine__advance
+#undef BM0__decoded_engine__advance_last
+#undef BM0__decoded_engine__fuse
+#undef BM0__decoded_engine__operate
+#undef BM0__decoded_engine__operate_nonzero
+
+/* Contexts */
+// everything a byte machine keeps between runs, so running a context again does not need the OS
+typedef struct BM0__context {
+    BM0__vector p_vectors[BM0__define__vector_register_count];
+    void* p_regs[BM0__define__register_count];
+    BM0__allocations* p_allocations;
+    BM0__arena p_arena; // only used when the context was created with an arena
+    BM0__boolean p_running; // started and has not quit yet
+} BM0__context;
+
+// frees what the last run left allocated, which needs no syscalls when it left nothing mapped
+void BM0__reset_context(BM0__context* context) {
+    BM0__wait_for_siblings((*context).p_allocations);
+    BM0__reset_allocations((*context).p_allocations, BM0__boolean__true);
+    (*context).p_running = BM0__boolean__false;
+
+    return;
+}
+
+void BM0__destroy_context(BM0__context* context) {
+    BM0__reset_context(context);
+    BM0__destroy_allocations((*context).p_allocations);
+    BM0__destroy_arena(&(*context).p_arena);
+    BM0__deallocate(context, sizeof(BM0__context));
+
+    return;
+}
+
+BM0__context* BM0__create_context(BM0__et* error, unsigned long long max_allocation_count, BM0__boolean use_arena) {
+    BM0__context* context = (BM0__context*)BM0__allocate(sizeof(BM0__context));
+
+    if (context == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+
+    // setup
+    (*context).p_arena = BM0__create_arena();
+    (*context).p_allocations = BM0__create_null_allocations(max_allocation_count, use_arena ? &(*context).p_arena : 0);
+    if ((*context).p_allocations == 0) {
+        BM0__deallocate(context, sizeof(BM0__context));
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    *error = BM0__et__no_error;
+
+    return context;
+}
+
+// resets the context and sets it up to run the input, returns false if the input is invalid
+BM0__boolean BM0__start_context(BM0__et* error, BM0__context* context, BM0__buffer input_buffers_buffer) {
+    BM0__reset_context(context);
+    (*context).p_running = BM0__prepare_byte_machine(error, input_buffers_buffer, (*context).p_regs, (*context).p_vectors);
+#ifdef BM0__enable__trace
+    if ((*context).p_running && (*(*context).p_allocations).p_trace != 0) {
+        (*(*(*context).p_allocations).p_trace).p_program = ((BM0__buffer*)input_buffers_buffer.p_data)[0];
+    }
+#endif
+
+    return (*context).p_running;
+}
+
+#ifdef BM0__enable__trace
+// finishes the last entry once a run stops and prints the trace when the machine quit with debug info or ended in an error
+void BM0__stop_tracing_context(BM0__et* error, BM0__context* context, BM0__boolean final_debug_info) {
+    BM0__trace* trace = (*(*context).p_allocations).p_trace;
+
+    if (trace == 0) {
+        return;
+    }
+
+    BM0__finish_tracing_instruction(trace, (*context).p_regs);
+    if ((*context).p_running) {
+        return;
+    }
+    if (final_debug_info == BM0__boolean__true && *error == BM0__et__no_error) {
+        printf("Instruction 'quit' called, dumping trace and quitting byte machine...\n");
+        BM0__print_trace(trace, stdout);
+    }
+    if ((*trace).p_error_file != 0 && (*error != BM0__et__no_error || (*context).p_regs[(unsigned char)(unsigned long long)(*context).p_regs[BM0__rt__instruction_error_code_register_register]] != 0)) {
+        BM0__print_trace(trace, (*trace).p_error_file);
+    }
+
+    return;
+}
+#endif
+
+// runs a started context for at most instruction_budget instructions with the decoded engine, or the regular engine when the program is null
+// returns true when the budget ran out first, the machine can then be resumed later with either engine, and false once it has quit or hit a critical error
+BM0__boolean BM0__resume_context(BM0__et* error, BM0__context* context, BM0__program* program, unsigned long long instruction_budget, BM0__buffer* output, BM0__boolean final_debug_info) {
+    if ((*context).p_running == BM0__boolean__false) {
+        return BM0__boolean__false;
+    }
+
+    // decoded engine
+    if (program != 0) {
+        (*context).p_running = BM0__run_decoded_program(error, program, (*context).p_regs, (*context).p_vectors, (*context).p_allocations, &instruction_budget, output, final_debug_info);
+        if ((*context).p_running == BM0__boolean__false) {
+            BM0__wait_for_siblings((*context).p_allocations);
+        }
+#ifdef BM0__enable__trace
+        BM0__stop_tracing_context(error, context, final_debug_info);
+#endif
+
+        return (*context).p_running;
+    }
+
+    // regular engine
+    while (instruction_budget > 0) {
+        instruction_budget--;
+#ifdef BM0__enable__profiler
+        if ((*(*context).p_allocations).p_profile != 0) {
+            BM0__profile_instruction((*(*context).p_allocations).p_profile, (*context).p_regs);
+        }
+#endif
+#ifdef BM0__enable__trace
+        if ((*(*context).p_allocations).p_trace != 0) {
+            BM0__trace_instruction((*(*context).p_allocations).p_trace, (*context).p_regs);
+        }
+#endif
+        if (BM0__step_byte_machine(error, (*context).p_regs, (*context).p_vectors, (*context).p_allocations, output, final_debug_info) == BM0__boolean__false) {
+            (*context).p_running = BM0__boolean__false;
+            BM0__wait_for_siblings((*context).p_allocations);
+
+            break;
+        }
+    }
+#ifdef BM0__enable__profiler
+    if ((*(*context).p_allocations).p_profile != 0) {
+        BM0__stop_profiling_instruction((*(*context).p_allocations).p_profile);
+    }
+#endif
+#ifdef BM0__enable__trace
+    BM0__stop_tracing_context(error, context, final_debug_info);
+#endif
+
+    return (*context).p_running;
+}
+
+// attaches a channel under a number from 0 to BM0__define__max_channel_count - 1 for every following run, zero detaches it
+// the channel must outlive the context or be detached first
+void BM0__attach_channel_to_context(BM0__context* context, unsigned long long channel_number, BM0__channel* channel) {
+    (*(*context).p_allocations).p_channels[channel_number] = channel;
+
+    return;
+}
+
+// sets the BM0__apt bits the allocate instruction uses for every following run, allocate_with_policy picks its own
+void BM0__set_context_allocation_policy(BM0__context* context, unsigned long long policy) {
+    (*(*context).p_allocations).p_policy = policy;
+
+    return;
+}
+
+#ifdef BM0__enable__profiler
+// every run of the context is added to the profile until another profile, or zero, is attached
+void BM0__attach_profile_to_context(BM0__context* context, BM0__profile* profile) {
+    (*(*context).p_allocations).p_profile = profile;
+
+    return;
+}
+#endif
+
+#ifdef BM0__enable__trace
+// every following run of the context is recorded into the trace until another trace, or zero, is attached
+// the trace keeps its entries between runs, so a run that ends in an error still shows how the runs before it ended
+void BM0__attach_trace_to_context(BM0__context* context, BM0__trace* trace) {
+    (*(*context).p_allocations).p_trace = trace;
+
+    return;
+}
+#endif
+
+// starts the context and runs it until it quits, the output stays valid until the context is reset again
+BM0__buffer BM0__run_context(BM0__et* error, BM0__context* context, BM0__buffer input_buffers_buffer, BM0__program* program, BM0__boolean final_debug_info) {
+    BM0__buffer output = BM0__create_null_buffer();
+
+    if (BM0__start_context(error, context, input_buffers_buffer)) {
+        while (BM0__resume_context(error, context, program, ~0ull, &output, final_debug_info)) {}
+    }
+
+    return output;
+}
+
+/* Snapshots */
+// where a snapshotted register pointed, registers pointing into an input sub-buffer or allocation are moved along with it when forked
+typedef enum BM0__srt {
+    BM0__srt__value,
+    BM0__srt__input_buffer, // plus the input sub-buffer index
+    BM0__srt__allocation = BM0__srt__input_buffer + BM0__define__max_input_sub_buffer_count // plus the handle
+} BM0__srt;
+
+// a paused machine, its allocations are stored in one memory file that every fork maps copy-on-write
+typedef struct BM0__snapshot {
+    BM0__vector p_vectors[BM0__define__vector_register_count];
+    void* p_regs[BM0__define__register_count]; // the offset into the buffer for registers that pointed into one
+    unsigned short p_register_targets[BM0__define__register_count]; // BM0__srt
+    BM0__buffer* p_buffers; // the allocation table's used slots, freed slots keep the next freed slot in place of their length
+    unsigned long long* p_file_offsets; // where each live allocation is stored in the memory file
+    unsigned char* p_types; // BM0__att per slot, only hash tables keep their type since everything else is forked as a mapping
+    unsigned long long p_slot_count;
+    unsigned long long p_used_slot_count;
+    unsigned long long p_live_count;
+    unsigned long long p_free_slot;
+    int p_file; // memory file holding the allocations
+} BM0__snapshot;
+
+unsigned long long BM0__get_snapshot_length(unsigned long long used_slot_count) {
+    return sizeof(BM0__snapshot) + ((sizeof(BM0__buffer) + sizeof(unsigned long long) + sizeof(unsigned char)) * used_slot_count);
+}
+
+unsigned long long BM0__align_snapshot_offset(unsigned long long offset) {
+    return (offset + BM0__define__snapshot_page_length - 1) & ~((unsigned long long)BM0__define__snapshot_page_length - 1);
+}
+
+void BM0__destroy_snapshot(BM0__snapshot* snapshot) {
+    if ((*snapshot).p_file >= 0) {
+        close((*snapshot).p_file);
+    }
+    BM0__deallocate(snapshot, BM0__get_snapshot_length((*snapshot).p_used_slot_count));
+
+    return;
+}
+
+// finds which input sub-buffer or allocation a register points into, one past the end counts since loops often keep an end pointer
+unsigned short BM0__find_snapshot_register_target(BM0__context* context, void* value, unsigned long long* offset) {
+    BM0__allocations* allocations = (*context).p_allocations;
+    BM0__buffer* inputs = (BM0__buffer*)(*context).p_regs[BM0__rt__input_buffers_pointer_register];
+    unsigned long long input_count = (unsigned long long)(*context).p_regs[BM0__rt__input_buffers_length_register] / sizeof(BM0__buffer);
+
+    for (unsigned long long i = 0; i < input_count && i < BM0__define__max_input_sub_buffer_count; i++) {
+        if (value >= inputs[i].p_data && (unsigned long long)(value - inputs[i].p_data) <= inputs[i].p_length && inputs[i].p_data != 0) {
+            *offset = (unsigned long long)(value - inputs[i].p_data);
+
+            return BM0__srt__input_buffer + i;
+        }
+    }
+    for (unsigned long long i = 0; i < (*allocations).p_used_slot_count; i++) {
+        if ((*allocations).p_buffers[i].p_data != 0 && value >= (*allocations).p_buffers[i].p_data && (unsigned long long)(value - (*allocations).p_buffers[i].p_data) <= (*allocations).p_buffers[i].p_length) {
+            *offset = (unsigned long long)(value - (*allocations).p_buffers[i].p_data);
+
+            return BM0__srt__allocation + i;
+        }
+    }
+
+    return BM0__srt__value;
+}
+
+// snapshots a started context that has not quit, for example one paused by BM0__resume_context, returns zero on failure
+// the context is left as it was and can keep running, machines with threads cannot be snapshotted
+BM0__snapshot* BM0__create_snapshot(BM0__et* error, BM0__context* context) {
+    BM0__allocations* allocations = (*context).p_allocations;
+    BM0__snapshot* snapshot;
+    unsigned long long file_length = 0;
+    unsigned long long offset;
+    void* file_data;
+
+    if ((*context).p_running == BM0__boolean__false || (*allocations).p_siblings != 0) {
+        *error = BM0__et__snapshot_unavailable;
+
+        return 0;
+    }
+
+    // setup
+    snapshot = (BM0__snapshot*)BM0__allocate(BM0__get_snapshot_length((*allocations).p_used_slot_count));
+    if (snapshot == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    (*snapshot).p_buffers = (BM0__buffer*)(snapshot + 1);
+    (*snapshot).p_file_offsets = (unsigned long long*)((*snapshot).p_buffers + (*allocations).p_used_slot_count);
+    (*snapshot).p_types = (unsigned char*)((*snapshot).p_file_offsets + (*allocations).p_used_slot_count);
+    (*snapshot).p_slot_count = (*allocations).p_slot_count;
+    (*snapshot).p_used_slot_count = (*allocations).p_used_slot_count;
+    (*snapshot).p_live_count = (*allocations).p_live_count;
+    (*snapshot).p_free_slot = (*allocations).p_free_slot;
+    BM0__copy_bytes((*allocations).p_buffers, sizeof(BM0__buffer) * (*allocations).p_used_slot_count, (*snapshot).p_buffers);
+    BM0__copy_bytes((*allocations).p_types, (*allocations).p_used_slot_count, (*snapshot).p_types);
+    BM0__copy_bytes((*context).p_vectors, sizeof((*snapshot).p_vectors), (*snapshot).p_vectors);
+
+    // lay out the memory file
+    for (unsigned long long i = 0; i < (*snapshot).p_used_slot_count; i++) {
+        (*snapshot).p_file_offsets[i] = file_length;
+        if ((*snapshot).p_buffers[i].p_data != 0) {
+            file_length = BM0__align_snapshot_offset(file_length + (*snapshot).p_buffers[i].p_length + ((*snapshot).p_buffers[i].p_length == 0));
+        }
+    }
+
+    // store allocations
+    (*snapshot).p_file = (int)syscall(__NR_memfd_create, "BM0 snapshot", MFD_CLOEXEC);
+    if ((*snapshot).p_file < 0 || ftruncate((*snapshot).p_file, (off_t)file_length) != 0) {
+        BM0__destroy_snapshot(snapshot);
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    if (file_length > 0) {
+        file_data = mmap(0, file_length, PROT_READ | PROT_WRITE, MAP_SHARED, (*snapshot).p_file, 0);
+        if (file_data == MAP_FAILED) {
+            BM0__destroy_snapshot(snapshot);
+            *error = BM0__et__allocation_failure__os_rejected_request;
+
+            return 0;
+        }
+        for (unsigned long long i = 0; i < (*snapshot).p_used_slot_count; i++) {
+            if ((*snapshot).p_buffers[i].p_data != 0) {
+                BM0__copy_bytes((*snapshot).p_buffers[i].p_data, (*snapshot).p_buffers[i].p_length, file_data + (*snapshot).p_file_offsets[i]);
+            }
+        }
+        BM0__deallocate(file_data, file_length);
+    }
+
+    // store registers, the input buffer registers are always taken from the input a fork is given
+    for (unsigned long long i = 0; i < BM0__define__register_count; i++) {
+        offset = 0;
+        (*snapshot).p_register_targets[i] = BM0__srt__value;
+        if (i != BM0__rt__input_buffers_length_register && i != BM0__rt__input_buffers_pointer_register) {
+            (*snapshot).p_register_targets[i] = BM0__find_snapshot_register_target(context, (*context).p_regs[i], &offset);
+        }
+        (*snapshot).p_regs[i] = (*snapshot).p_register_targets[i] == BM0__srt__value ? (*context).p_regs[i] : (void*)offset;
+    }
+    *error = BM0__et__no_error;
+
+    return snapshot;
+}
+
+// resets the context and sets it up to continue where the snapshot was taken on a new input, returns false if that failed
+// allocations are mapped copy-on-write, so only the pages a fork writes to are copied
+BM0__boolean BM0__fork_snapshot_to_context(BM0__et* error, BM0__snapshot* snapshot, BM0__context* context, BM0__buffer input_buffers_buffer) {
+    BM0__allocations* allocations = (*context).p_allocations;
+    BM0__buffer* inputs = (BM0__buffer*)input_buffers_buffer.p_data;
+    unsigned long long input_count = input_buffers_buffer.p_length / sizeof(BM0__buffer);
+    unsigned long long target;
+    void* address;
+
+    if (BM0__start_context(error, context, input_buffers_buffer) == BM0__boolean__false) {
+        return BM0__boolean__false;
+    }
+    (*context).p_running = BM0__boolean__false;
+    if ((*snapshot).p_used_slot_count > (*allocations).p_slot_count) {
+        *error = BM0__et__allocation_failure__at_maximum;
+
+        return BM0__boolean__false;
+    }
+
+    // map allocations under the same handles, the end of the freed slot list is moved to this table's slot count
+    for (unsigned long long i = 0; i < (*snapshot).p_used_slot_count; i++) {
+        if ((*snapshot).p_buffers[i].p_data == 0) {
+            (*allocations).p_buffers[i].p_data = 0;
+            (*allocations).p_buffers[i].p_length = (*snapshot).p_buffers[i].p_length == (*snapshot).p_slot_count ? (*allocations).p_slot_count : (*snapshot).p_buffers[i].p_length;
+        } else {
+            address = mmap(0, (*snapshot).p_buffers[i].p_length + ((*snapshot).p_buffers[i].p_length == 0), PROT_READ | PROT_WRITE, MAP_PRIVATE, (*snapshot).p_file, (off_t)(*snapshot).p_file_offsets[i]);
+            if (address == MAP_FAILED) {
+                BM0__reset_allocations(allocations, BM0__boolean__true);
+                *error = BM0__et__allocation_failure__os_rejected_request;
+
+                return BM0__boolean__false;
+            }
+            (*allocations).p_buffers[i].p_data = address;
+            (*allocations).p_buffers[i].p_length = (*snapshot).p_buffers[i].p_length + ((*snapshot).p_buffers[i].p_length == 0);
+            (*allocations).p_types[i] = (*snapshot).p_types[i] == BM0__att__hash_table ? BM0__att__hash_table : BM0__att__mapping;
+        }
+        (*allocations).p_used_slot_count = i + 1;
+    }
+    (*allocations).p_live_count = (*snapshot).p_live_count;
+    (*allocations).p_free_slot = (*snapshot).p_free_slot == (*snapshot).p_slot_count ? (*allocations).p_slot_count : (*snapshot).p_free_slot;
+
+    // restore registers
+    for (unsigned long long i = 0; i < BM0__define__register_count; i++) {
+        target = (*snapshot).p_register_targets[i];
+        if (i == BM0__rt__input_buffers_length_register || i == BM0__rt__input_buffers_pointer_register) {
+            continue;
+        } else if (target == BM0__srt__value) {
+            (*context).p_regs[i] = (*snapshot).p_regs[i];
+        } else if (target >= BM0__srt__allocation) {
+            (*context).p_regs[i] = (*allocations).p_buffers[target - BM0__srt__allocation].p_data + (unsigned long long)(*snapshot).p_regs[i];
+        } else if (target - BM0__srt__input_buffer < input_count && (unsigned long long)(*snapshot).p_regs[i] <= inputs[target - BM0__srt__input_buffer].p_length) {
+            (*context).p_regs[i] = inputs[target - BM0__srt__input_buffer].p_data + (unsigned long long)(*snapshot).p_regs[i];
+        } else {
+            // the new input is missing a sub-buffer the machine was pointing into
+            BM0__reset_allocations(allocations, BM0__boolean__true);
+            *error = BM0__et__invalid_input_buffer;
+
+            return BM0__boolean__false;
+        }
+    }
+    BM0__copy_bytes((*snapshot).p_vectors, sizeof((*snapshot).p_vectors), (*context).p_vectors);
+    (*context).p_running = BM0__boolean__true;
+
+    return BM0__boolean__true;
+}
+
+// forks the snapshot to the context and runs it until it quits, the output stays valid until the context is reset again
+BM0__buffer BM0__run_snapshot(BM0__et* error, BM0__snapshot* snapshot, BM0__context* context, BM0__buffer input_buffers_buffer, BM0__program* program, BM0__boolean final_debug_info) {
+    BM0__buffer output = BM0__create_null_buffer();
+
+    if (BM0__fork_snapshot_to_context(error, snapshot, context, input_buffers_buffer)) {
+        while (BM0__resume_context(error, context, program, ~0ull, &output, final_debug_info)) {}
+    }
+
+    return output;
+}
+
+/* Batches */
+// one thread of a thread pool, its context is reused by every job it runs
+typedef struct BM0__batch_worker {
+    BM0__context* p_context;
+    unsigned long long p_jobs; // the next job in the low 32 bits and the end of this worker's jobs in the high 32 bits
+    struct BM0__thread_pool* p_pool;
+    unsigned long long p_index;
+    pthread_t p_thread;
+    unsigned long long p_padding[3]; // keeps each worker's jobs on its own cache line
+} BM0__batch_worker;
+
+typedef struct BM0__thread_pool {
+    // workers, stored right before the pool in one mapping
+    BM0__batch_worker* p_workers;
+    unsigned long long p_worker_count;
+    unsigned long long p_thread_count; // threads actually started
+
+    // current batch
+    BM0__buffer* p_inputs;
+    BM0__buffer* p_outputs;
+    BM0__et* p_errors;
+
+    // workers wait for the generation to change, the caller waits for every worker to run out of jobs
+    pthread_mutex_t p_lock;
+    pthread_cond_t p_work_ready;
+    pthread_cond_t p_work_done;
+    unsigned long long p_generation;
+    unsigned long long p_busy_count;
+    BM0__boolean p_stopping;
+} BM0__thread_pool;
+
+// workers take their own jobs from the front and steal half of another worker's remaining jobs from the back
+BM0__boolean BM0__take_batch_job(BM0__thread_pool* pool, BM0__batch_worker* worker, unsigned long long* job) {
+    BM0__batch_worker* victim;
+    unsigned long long jobs;
+    unsigned long long next;
+    unsigned long long end;
+    unsigned long long stolen;
+
+    // own jobs
+    jobs = __atomic_load_n(&(*worker).p_jobs, __ATOMIC_ACQUIRE);
+    while ((jobs & 0xFFFFFFFF) < (jobs >> 32)) {
+        if (__atomic_compare_exchange_n(&(*worker).p_jobs, &jobs, jobs + 1, BM0__boolean__false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *job = jobs & 0xFFFFFFFF;
+
+            return BM0__boolean__true;
+        }
+    }
+
+    // stolen jobs, the first is run right away and the rest become this worker's own
+    for (unsigned long long i = 1; i < (*pool).p_worker_count; i++) {
+        victim = &(*pool).p_workers[((*worker).p_index + i) % (*pool).p_worker_count];
+        jobs = __atomic_load_n(&(*victim).p_jobs, __ATOMIC_ACQUIRE);
+        while ((next = jobs & 0xFFFFFFFF) < (end = jobs >> 32)) {
+            stolen = (end - next + 1) / 2;
+            if (__atomic_compare_exchange_n(&(*victim).p_jobs, &jobs, ((end - stolen) << 32) | next, BM0__boolean__false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                *job = end - stolen;
+                __atomic_store_n(&(*worker).p_jobs, (end << 32) | (end - stolen + 1), __ATOMIC_RELEASE);
+
+                return BM0__boolean__true;
+            }
+        }
+    }
+
+    return BM0__boolean__false;
+}
+
+// buffers left allocated by a job are freed, except for the one its output points into which is handed to the caller
+void BM0__run_batch_job(BM0__thread_pool* pool, BM0__batch_worker* worker, unsigned long long job) {
+    BM0__context* context = (*worker).p_context;
+    BM0__allocations* allocations = (*context).p_allocations;
+    BM0__et* error = &(*pool).p_errors[job];
+    BM0__buffer output = BM0__create_null_buffer();
+
+    if (BM0__prepare_byte_machine(error, (*pool).p_inputs[job], (*context).p_regs, (*context).p_vectors)) {
+        while (BM0__step_byte_machine(error, (*context).p_regs, (*context).p_vectors, allocations, &output, BM0__boolean__false)) {}
+        BM0__wait_for_siblings(allocations);
+
+        // io still in flight may write into the buffers
+        if ((*allocations).p_io_queue != 0) {
+            BM0__drain_io_queue((*allocations).p_io_queue);
+        }
+        for (unsigned long long i = 0; i < (*allocations).p_used_slot_count; i++) {
+            if ((*allocations).p_buffers[i].p_data != 0 && (output.p_data < (*allocations).p_buffers[i].p_data || output.p_data >= (*allocations).p_buffers[i].p_data + (*allocations).p_buffers[i].p_length)) {
+                BM0__free_allocation(allocations, i);
+            }
+        }
+        BM0__reset_allocations(allocations, BM0__boolean__false);
+    }
+    (*pool).p_outputs[job] = output;
+
+    return;
+}
+
+void* BM0__run_batch_worker(void* worker_pointer) {
+    BM0__batch_worker* worker = (BM0__batch_worker*)worker_pointer;
+    BM0__thread_pool* pool = (*worker).p_pool;
+    unsigned long long generation = 0;
+    unsigned long long job;
+
+    pthread_mutex_lock(&(*pool).p_lock);
+    while (BM0__boolean__true) {
+        while ((*pool).p_generation == generation && (*pool).p_stopping == BM0__boolean__false) {
+            pthread_cond_wait(&(*pool).p_work_ready, &(*pool).p_lock);
+        }
+        if ((*pool).p_stopping) {
+            break;
+        }
+        generation = (*pool).p_generation;
+        pthread_mutex_unlock(&(*pool).p_lock);
+
+        // run jobs until none are left anywhere
+        while (BM0__take_batch_job(pool, worker, &job)) {
+            BM0__run_batch_job(pool, worker, job);
+        }
+
+        pthread_mutex_lock(&(*pool).p_lock);
+        (*pool).p_busy_count--;
+        if ((*pool).p_busy_count == 0) {
+            pthread_cond_signal(&(*pool).p_work_done);
+        }
+    }
+    pthread_mutex_unlock(&(*pool).p_lock);
+
+    return 0;
+}
+
+// stops the threads and frees their contexts, buffers left allocated by jobs stay valid
+void BM0__destroy_thread_pool(BM0__thread_pool* pool) {
+    BM0__batch_worker* workers = (*pool).p_workers;
+    unsigned long long worker_count = (*pool).p_worker_count;
+
+    pthread_mutex_lock(&(*pool).p_lock);
+    (*pool).p_stopping = BM0__boolean__true;
+    pthread_cond_broadcast(&(*pool).p_work_ready);
+    pthread_mutex_unlock(&(*pool).p_lock);
+    for (unsigned long long i = 0; i < (*pool).p_thread_count; i++) {
+        pthread_join(workers[i].p_thread, 0);
+    }
+    for (unsigned long long i = 0; i < worker_count; i++) {
+        if (workers[i].p_context != 0) {
+            BM0__destroy_context(workers[i].p_context);
+        }
+    }
+    pthread_cond_destroy(&(*pool).p_work_done);
+    pthread_cond_destroy(&(*pool).p_work_ready);
+    pthread_mutex_destroy(&(*pool).p_lock);
+    BM0__deallocate(workers, (sizeof(BM0__batch_worker) * worker_count) + sizeof(BM0__thread_pool));
+
+    return;
+}
+
+// a thread count of zero starts one thread per online core
+BM0__thread_pool* BM0__create_thread_pool(BM0__et* error, unsigned long long thread_count) {
+    BM0__batch_worker* workers;
+    BM0__thread_pool* pool;
+
+    if (thread_count == 0) {
+        thread_count = (unsigned long long)sysconf(_SC_NPROCESSORS_ONLN);
+        if ((long long)thread_count < 1) {
+            thread_count = 1;
+        }
+    }
+
+    // workers come first to keep them cache line aligned
+    workers = (BM0__batch_worker*)BM0__allocate((sizeof(BM0__batch_worker) * thread_count) + sizeof(BM0__thread_pool));
+    if (workers == 0) {
+        *error = BM0__et__allocation_failure__os_rejected_request;
+
+        return 0;
+    }
+    pool = (BM0__thread_pool*)(workers + thread_count);
+    (*pool).p_workers = workers;
+    (*pool).p_worker_count = thread_count;
+    (*pool).p_thread_count = 0;
+    (*pool).p_generation = 0;
+    (*pool).p_busy_count = 0;
+    (*pool).p_stopping = BM0__boolean__false;
+    pthread_mutex_init(&(*pool).p_lock, 0);
+    pthread_cond_init(&(*pool).p_work_ready, 0);
+    pthread_cond_init(&(*pool).p_work_done, 0);
+
+    // workers
+    *error = BM0__et__no_error;
+    for (unsigned long long i = 0; i < thread_count && *error == BM0__et__no_error; i++) {
+        workers[i].p_context = BM0__create_context(error, BM0__define__max_allocation_count, BM0__boolean__false);
+        workers[i].p_pool = pool;
+        workers[i].p_index = i;
+    }
+    for (unsigned long long i = 0; i < thread_count && *error == BM0__et__no_error; i++) {
+        if (pthread_create(&workers[i].p_thread, 0, BM0__run_batch_worker, &workers[i]) != 0) {
+            *error = BM0__et__thread_pool_unavailable;
+        } else {
+            (*pool).p_thread_count++;
+        }
+    }
+    if (*error != BM0__et__no_error) {
+        BM0__destroy_thread_pool(pool);
+
+        return 0;
+    }
+
+    return pool;
+}
+
+// runs every input on the pool and waits for all of them, each job gets its own output and error like BM0__run_byte_machine gives
+void BM0__run_byte_machines(BM0__et* error, BM0__thread_pool* pool, BM0__buffer* inputs, BM0__buffer* outputs, BM0__et* errors, unsigned long long count) {
+    // job numbers are packed two to a word
+    if (count > 0xFFFFFFFF) {
+        *error = BM0__et__batch_too_large;
+
+        return;
+    }
+    *error = BM0__et__no_error;
+
+    pthread_mutex_lock(&(*pool).p_lock);
+    (*pool).p_inputs = inputs;
+    (*pool).p_outputs = outputs;
+    (*pool).p_errors = errors;
+
+    // split jobs evenly, stealing evens out jobs that take longer than others
+    for (unsigned long long i = 0; i < (*pool).p_worker_count; i++) {
+        __atomic_store_n(&(*pool).p_workers[i].p_jobs, (((count * (i + 1)) / (*pool).p_worker_count) << 32) | ((count * i) / (*pool).p_worker_count), __ATOMIC_RELEASE);
+    }
+
+    // start and wait
+    (*pool).p_busy_count = (*pool).p_worker_count;
+    (*pool).p_generation++;
+    pthread_cond_broadcast(&(*pool).p_work_ready);
+    while ((*pool).p_busy_count > 0) {
+        pthread_cond_wait(&(*pool).p_work_done, &(*pool).p_lock);
+    }
+    pthread_mutex_unlock(&(*pool).p_lock);
+
+    return;
+}
+
 #endif
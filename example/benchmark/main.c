@@ -0,0 +1,476 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../BM0.h"
+
+/* Benchmark */
+// every workload is timed on every engine and compared against BM0__run_byte_machine
+typedef enum BM0__benchmark__engine {
+    BM0__benchmark__engine__run_byte_machine,
+    BM0__benchmark__engine__run_decoded_byte_machine,
+    BM0__benchmark__engine__run_decoded_byte_machine_with_arena,
+    BM0__benchmark__engine__run_decoded_byte_machine_optimized,
+    BM0__benchmark__engine__run_context,
+    BM0__benchmark__engine__run_context_decoded,
+#ifdef BM0__enable__jit
+    BM0__benchmark__engine__run_context_jit,
+#endif
+    BM0__benchmark__engine__run_byte_machines,
+    BM0__benchmark__engine__COUNT
+} BM0__benchmark__engine;
+
+char* BM0__benchmark__get_engine_name(BM0__benchmark__engine engine) {
+    static char* names[] = {
+        "run_byte_machine",
+        "run_decoded_byte_machine",
+        "run_decoded_byte_machine_with_arena",
+        "run_decoded_byte_machine_optimized",
+        "run_context",
+        "run_context_decoded",
+#ifdef BM0__enable__jit
+        "run_context_jit",
+#endif
+        "run_byte_machines"
+    };
+
+    return names[engine];
+}
+
+// registers shared by every generated program
+typedef enum BM0__benchmark__register {
+    BM0__benchmark__register__error = 19, // the error code register points here
+    BM0__benchmark__register__one = 13,
+    BM0__benchmark__register__iteration_count = 14,
+    BM0__benchmark__register__counter = 15,
+    BM0__benchmark__register__flag = 16,
+    BM0__benchmark__register__jump_distance = 17,
+    BM0__benchmark__register__checksum = 18,
+} BM0__benchmark__register;
+
+// one generated program that is run a number of times per measurement
+typedef struct BM0__benchmark__workload {
+    char* p_name;
+    BM0__buffer p_program;
+    BM0__buffer p_input; // the input buffers, the 0th is the program
+    unsigned long long p_run_count;
+    unsigned long long p_allocations_per_run; // how many allocate instructions one run executes
+    unsigned long long p_instructions_per_run; // counted by stepping the program once
+} BM0__benchmark__workload;
+
+double BM0__benchmark__get_time() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + ((double)time.tv_nsec * 1e-9);
+}
+
+/* Program Generation */
+// sets up the error code register and the loop registers, returns where the loop body starts
+void* BM0__benchmark__write_prologue(void* index, unsigned long long iteration_count) {
+    index = BM0__write_instruction__write_register(index, BM0__rt__instruction_error_code_register_register, BM0__benchmark__register__error);
+    index = BM0__write_instruction__write_register(index, BM0__benchmark__register__one, 1);
+    index = BM0__write_instruction__write_register(index, BM0__benchmark__register__iteration_count, iteration_count);
+    index = BM0__write_instruction__write_register(index, BM0__benchmark__register__counter, 0);
+    index = BM0__write_instruction__write_register(index, BM0__benchmark__register__checksum, 0);
+
+    return index;
+}
+
+// counts an iteration and jumps back to the top of the loop until every iteration has run
+void* BM0__benchmark__write_loop_end(void* index, void* program, void* loop_top) {
+    unsigned long long jump_offset;
+
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, BM0__benchmark__register__counter, BM0__benchmark__register__one, BM0__benchmark__register__counter);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__comparison__less_than, BM0__benchmark__register__counter, BM0__benchmark__register__iteration_count, BM0__benchmark__register__flag);
+
+    // the jump adds the distance to the instruction pointer, then the operate instruction's length is added
+    jump_offset = (unsigned long long)(index - program) + BM0__ilt__write_register;
+    index = BM0__write_instruction__write_register(index, BM0__benchmark__register__jump_distance, (unsigned long long)(loop_top - program) - jump_offset - BM0__ilt__operate);
+    index = BM0__write_instruction__operate(index, BM0__benchmark__register__flag, 0, BM0__ot__integer__add, BM0__rt__instruction_pointer_register, BM0__benchmark__register__jump_distance, BM0__rt__instruction_pointer_register);
+
+    return index;
+}
+
+// arithmetic on registers only
+void* BM0__benchmark__write_operate_loop(void* program, unsigned long long iteration_count) {
+    void* index = BM0__benchmark__write_prologue(program, iteration_count);
+    void* loop_top;
+
+    index = BM0__write_instruction__write_register(index, 20, 0x9E3779B97F4A7C15ull);
+    loop_top = index;
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__multiply, BM0__benchmark__register__counter, 20, 21);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__binary__xor, BM0__benchmark__register__checksum, 21, BM0__benchmark__register__checksum);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__binary__right_shift, BM0__benchmark__register__checksum, BM0__benchmark__register__one, 22);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, BM0__benchmark__register__checksum, 22, BM0__benchmark__register__checksum);
+    index = BM0__benchmark__write_loop_end(index, program, loop_top);
+    index = BM0__write_instruction__quit(index, BM0__benchmark__register__checksum, BM0__benchmark__register__counter);
+
+    return index;
+}
+
+// copies 8 bytes at a time from one buffer to another through a register, wrapping around at the end of the buffers
+void* BM0__benchmark__write_memory_copy_loop(void* program, unsigned long long iteration_count, unsigned long long buffer_length) {
+    void* index = BM0__benchmark__write_prologue(program, iteration_count);
+    void* loop_top;
+
+    index = BM0__write_instruction__write_register(index, 30, buffer_length);
+    index = BM0__write_instruction__write_register(index, 31, sizeof(unsigned long long));
+    index = BM0__write_instruction__write_register(index, 32, buffer_length - 1);
+    index = BM0__write_instruction__write_register(index, 33, 0);
+    index = BM0__write_instruction__allocate(index, 30, 40, 41, 42);
+    index = BM0__write_instruction__allocate(index, 30, 43, 44, 45);
+    loop_top = index;
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, 41, 33, 46);
+    index = BM0__write_instruction__buffer_to_register(index, 46, 8, 47);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, 47, BM0__benchmark__register__counter, 47);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__binary__xor, BM0__benchmark__register__checksum, 47, BM0__benchmark__register__checksum);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, 44, 33, 48);
+    index = BM0__write_instruction__register_to_buffer(index, 47, 8, 48);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, 33, 31, 33);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__binary__and, 33, 32, 33);
+    index = BM0__benchmark__write_loop_end(index, program, loop_top);
+    index = BM0__write_instruction__deallocate(index, 40);
+    index = BM0__write_instruction__deallocate(index, 43);
+    index = BM0__write_instruction__quit(index, BM0__benchmark__register__checksum, BM0__benchmark__register__counter);
+
+    return index;
+}
+
+// allocates, touches and deallocates a buffer every iteration
+void* BM0__benchmark__write_allocation_churn_loop(void* program, unsigned long long iteration_count, unsigned long long allocation_length) {
+    void* index = BM0__benchmark__write_prologue(program, iteration_count);
+    void* loop_top;
+
+    index = BM0__write_instruction__write_register(index, 30, allocation_length);
+    loop_top = index;
+    index = BM0__write_instruction__allocate(index, 30, 40, 41, 42);
+    index = BM0__write_instruction__register_to_buffer(index, BM0__benchmark__register__counter, 8, 41);
+    index = BM0__write_instruction__deallocate(index, 40);
+    index = BM0__benchmark__write_loop_end(index, program, loop_top);
+    index = BM0__write_instruction__quit(index, BM0__benchmark__register__error, BM0__benchmark__register__counter);
+
+    return index;
+}
+
+// writes and reads back a block of the file named by the 1st input buffer every iteration, cycling through the first megabyte
+void* BM0__benchmark__write_file_io_loop(void* program, unsigned long long iteration_count, unsigned long long block_length) {
+    void* index = BM0__benchmark__write_prologue(program, iteration_count);
+    void* loop_top;
+
+    // get the path's address out of the 1st input buffer
+    index = BM0__write_instruction__write_register(index, 30, sizeof(BM0__buffer) + sizeof(unsigned long long));
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, BM0__rt__input_buffers_pointer_register, 30, 31);
+    index = BM0__write_instruction__buffer_to_register(index, 31, sizeof(void*), 31);
+
+    // open the file and get a block to move through it
+    index = BM0__write_instruction__write_register(index, 32, O_RDWR);
+    index = BM0__write_instruction__do_x86_64_linux_syscall_limited(index, BM0__st__open, 31, 32, 0, 0, 0, 0, 33);
+    index = BM0__write_instruction__write_register(index, 34, block_length);
+    index = BM0__write_instruction__write_register(index, 35, 1048575);
+    index = BM0__write_instruction__write_register(index, 36, 0);
+    index = BM0__write_instruction__allocate(index, 34, 40, 41, 42);
+    loop_top = index;
+    index = BM0__write_instruction__register_to_buffer(index, BM0__benchmark__register__counter, 8, 41);
+    index = BM0__write_instruction__do_x86_64_linux_syscall_limited(index, BM0__st__pwrite, 33, 41, 34, 36, 0, 0, 37);
+    index = BM0__write_instruction__do_x86_64_linux_syscall_limited(index, BM0__st__pread, 33, 41, 34, 36, 0, 0, 37);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, BM0__benchmark__register__checksum, 37, BM0__benchmark__register__checksum);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__add, 36, 34, 36);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__binary__and, 36, 35, 36);
+    index = BM0__benchmark__write_loop_end(index, program, loop_top);
+    index = BM0__write_instruction__do_x86_64_linux_syscall_limited(index, BM0__st__close, 33, 0, 0, 0, 0, 0, 37);
+    index = BM0__write_instruction__deallocate(index, 40);
+    index = BM0__write_instruction__quit(index, BM0__benchmark__register__checksum, BM0__benchmark__register__counter);
+
+    return index;
+}
+
+// a handful of instructions, so setting up and tearing down the machine is most of the work
+void* BM0__benchmark__write_small_job(void* program) {
+    void* index = program;
+
+    index = BM0__write_instruction__write_register(index, BM0__rt__instruction_error_code_register_register, BM0__benchmark__register__error);
+    index = BM0__write_instruction__write_register(index, 20, 5);
+    index = BM0__write_instruction__write_register(index, 21, 7);
+    index = BM0__write_instruction__operate(index, 0, 127, BM0__ot__integer__multiply, 20, 21, 22);
+    index = BM0__write_instruction__quit(index, 22, 20);
+
+    return index;
+}
+
+/* Workloads */
+// the program gets its own buffer, any further input buffers are copied after it
+BM0__benchmark__workload BM0__benchmark__create_workload(BM0__et* error, char* name, BM0__buffer program, unsigned long long program_length, BM0__buffer* extra_inputs, unsigned long long extra_input_count, unsigned long long run_count, unsigned long long allocations_per_run) {
+    BM0__benchmark__workload output;
+
+    output.p_name = name;
+    output.p_program = program;
+    output.p_program.p_length = program_length;
+    output.p_input = BM0__create_buffer(error, sizeof(BM0__buffer) * (1 + extra_input_count));
+    output.p_run_count = run_count;
+    output.p_allocations_per_run = allocations_per_run;
+    output.p_instructions_per_run = 0;
+    if (*error != BM0__et__no_error) {
+        return output;
+    }
+
+    ((BM0__buffer*)output.p_input.p_data)[0] = output.p_program;
+    for (unsigned long long i = 0; i < extra_input_count; i++) {
+        ((BM0__buffer*)output.p_input.p_data)[1 + i] = extra_inputs[i];
+    }
+
+    return output;
+}
+
+// steps the program one instruction at a time with the regular engine
+unsigned long long BM0__benchmark__count_instructions(BM0__et* error, BM0__context* context, BM0__benchmark__workload* workload) {
+    BM0__buffer output = BM0__create_null_buffer();
+    unsigned long long count = 0;
+
+    if (BM0__start_context(error, context, (*workload).p_input) == BM0__boolean__false) {
+        return 0;
+    }
+    while (BM0__resume_context(error, context, 0, 1, &output, BM0__boolean__false)) {
+        count++;
+    }
+
+    // the quit instruction
+    return count + 1;
+}
+
+// runs every run of a workload on one engine and returns the seconds it took, the first run's output and error are kept for comparison
+double BM0__benchmark__run_workload(BM0__benchmark__workload* workload, BM0__benchmark__engine engine, BM0__context* context, BM0__program* program, BM0__thread_pool* pool, BM0__buffer* outputs, BM0__et* errors, BM0__buffer* inputs, BM0__buffer* first_output, BM0__et* first_error) {
+    BM0__arena arena = BM0__create_arena();
+    BM0__et error = BM0__et__no_error;
+    double start;
+    double end;
+
+    // batches get every run at once
+    for (unsigned long long i = 0; i < (*workload).p_run_count; i++) {
+        inputs[i] = (*workload).p_input;
+    }
+
+    start = BM0__benchmark__get_time();
+    for (unsigned long long i = 0; i < (*workload).p_run_count && engine != BM0__benchmark__engine__run_byte_machines; i++) {
+        error = BM0__et__no_error;
+        switch (engine) {
+        case BM0__benchmark__engine__run_byte_machine:
+            outputs[i] = BM0__run_byte_machine(&error, (*workload).p_input, BM0__boolean__false);
+
+            break;
+        case BM0__benchmark__engine__run_decoded_byte_machine:
+        case BM0__benchmark__engine__run_decoded_byte_machine_optimized:
+            outputs[i] = BM0__run_decoded_byte_machine(&error, (*workload).p_input, program, 0, BM0__define__max_allocation_count, BM0__boolean__false);
+
+            break;
+        case BM0__benchmark__engine__run_decoded_byte_machine_with_arena:
+            outputs[i] = BM0__run_decoded_byte_machine(&error, (*workload).p_input, program, &arena, BM0__define__max_allocation_count, BM0__boolean__false);
+
+            break;
+        case BM0__benchmark__engine__run_context:
+            outputs[i] = BM0__run_context(&error, context, (*workload).p_input, 0, BM0__boolean__false);
+
+            break;
+        case BM0__benchmark__engine__run_context_decoded:
+#ifdef BM0__enable__jit
+        case BM0__benchmark__engine__run_context_jit:
+#endif
+            outputs[i] = BM0__run_context(&error, context, (*workload).p_input, program, BM0__boolean__false);
+
+            break;
+        default:
+            break;
+        }
+        errors[i] = error;
+    }
+    if (engine == BM0__benchmark__engine__run_byte_machines) {
+        BM0__run_byte_machines(&error, pool, inputs, outputs, errors, (*workload).p_run_count);
+    }
+    end = BM0__benchmark__get_time();
+
+    // clean up
+    *first_output = outputs[0];
+    *first_error = errors[0];
+    if (error != BM0__et__no_error) {
+        *first_error = error;
+    }
+    BM0__destroy_arena(&arena);
+
+    return end - start;
+}
+
+/* Results */
+// the ns per instruction of a workload and engine in an earlier run of the benchmark, or a negative number if it is not there
+double BM0__benchmark__find_previous_result(FILE* previous_results, char* workload_name, char* engine_name) {
+    char line[1024];
+    char workload[256];
+    char engine[256];
+    double ns_per_instruction;
+
+    if (previous_results == 0) {
+        return -1.0;
+    }
+
+    rewind(previous_results);
+    while (fgets(line, sizeof(line), previous_results) != 0) {
+        if (sscanf(line, "%255[^\t]\t%255[^\t]\t%*s\t%*s\t%*s\t%*s\t%*s\t%lf", workload, engine, &ns_per_instruction) == 3 && strcmp(workload, workload_name) == 0 && strcmp(engine, engine_name) == 0) {
+            return ns_per_instruction;
+        }
+    }
+
+    return -1.0;
+}
+
+// takes the best of a few measurements per engine and prints one tab separated line per workload and engine
+void BM0__benchmark__measure_workload(BM0__et* error, BM0__benchmark__workload* workload, BM0__context* context, BM0__thread_pool* pool, FILE* previous_results) {
+    BM0__buffer outputs_buffer = BM0__create_buffer(error, sizeof(BM0__buffer) * (*workload).p_run_count * 2);
+    BM0__buffer errors_buffer = BM0__create_buffer(error, sizeof(BM0__et) * (*workload).p_run_count);
+    BM0__buffer* outputs = (BM0__buffer*)outputs_buffer.p_data;
+    BM0__buffer* inputs = outputs + (*workload).p_run_count;
+    BM0__et* errors = (BM0__et*)errors_buffer.p_data;
+    BM0__program program;
+    BM0__buffer baseline_output = BM0__create_null_buffer();
+    BM0__et baseline_error = BM0__et__no_error;
+    BM0__buffer output;
+    BM0__et run_error;
+    double baseline_seconds = 0.0;
+    double seconds;
+    double best_seconds;
+    double previous;
+    unsigned long long instructions;
+    unsigned long long allocations;
+
+    if (*error != BM0__et__no_error) {
+        return;
+    }
+
+    (*workload).p_instructions_per_run = BM0__benchmark__count_instructions(error, context, workload);
+    instructions = (*workload).p_instructions_per_run * (*workload).p_run_count;
+    allocations = (*workload).p_allocations_per_run * (*workload).p_run_count;
+    for (unsigned long long engine = 0; engine < BM0__benchmark__engine__COUNT; engine++) {
+        // decoding is not timed, a decoded program is meant to be reused between runs
+        program = BM0__create_program(error, (*workload).p_program);
+        if (engine == BM0__benchmark__engine__run_decoded_byte_machine_optimized) {
+            BM0__optimize_program(&program);
+        }
+#ifdef BM0__enable__jit
+        if (engine == BM0__benchmark__engine__run_context_jit) {
+            BM0__attach_jit_to_program(error, &program);
+        }
+#endif
+        best_seconds = 0.0;
+        for (unsigned long long i = 0; i < 3; i++) {
+            seconds = BM0__benchmark__run_workload(workload, (BM0__benchmark__engine)engine, context, &program, pool, outputs, errors, inputs, &output, &run_error);
+            if (i == 0 || seconds < best_seconds) {
+                best_seconds = seconds;
+            }
+        }
+        BM0__destroy_program(program);
+        if (engine == BM0__benchmark__engine__run_byte_machine) {
+            baseline_seconds = best_seconds;
+            baseline_output = output;
+            baseline_error = run_error;
+        }
+
+        // the outputs are checksums, so every engine has to give the same one
+        printf("%s\t%s\t%llu\t%llu\t%llu\t%.6f\t%.0f\t%.3f\t%.0f\t%.2f\t%d", (*workload).p_name, BM0__benchmark__get_engine_name((BM0__benchmark__engine)engine), (*workload).p_run_count, instructions, allocations, best_seconds, (double)instructions / best_seconds, (best_seconds * 1e9) / (double)instructions, (double)allocations / best_seconds, baseline_seconds / best_seconds, output.p_data == baseline_output.p_data && output.p_length == baseline_output.p_length && run_error == baseline_error);
+        if (previous_results != 0) {
+            previous = BM0__benchmark__find_previous_result(previous_results, (*workload).p_name, BM0__benchmark__get_engine_name((BM0__benchmark__engine)engine));
+            if (previous > 0.0) {
+                printf("\t%.3f\t%+.1f%%", previous, ((((best_seconds * 1e9) / (double)instructions) / previous) - 1.0) * 100.0);
+            } else {
+                printf("\t-\t-");
+            }
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    // clean up
+    BM0__destroy_buffer(outputs_buffer);
+    BM0__destroy_buffer(errors_buffer);
+
+    return;
+}
+
+int main(int argc, char** argv) {
+    BM0__et error = BM0__et__no_error;
+    BM0__buffer programs[5];
+    BM0__buffer path;
+    BM0__benchmark__workload workloads[5];
+    BM0__context* context;
+    BM0__thread_pool* pool;
+    FILE* previous_results = 0;
+    char* file_path = "/dev/shm/BM0_benchmark";
+    int file;
+
+    // an earlier run's output can be given to see the change per workload and engine
+    if (argc > 1) {
+        previous_results = fopen(argv[1], "r");
+        if (previous_results == 0) {
+            fprintf(stderr, "Could not open previous results '%s'.\n", argv[1]);
+
+            return 1;
+        }
+    }
+
+    // the file workload runs on tmpfs when there is one
+    file = open(file_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (file < 0) {
+        file_path = "/tmp/BM0_benchmark";
+        file = open(file_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    }
+    if (file < 0) {
+        fprintf(stderr, "Could not create the benchmark file.\n");
+
+        return 1;
+    }
+    close(file);
+
+    // build workloads
+    for (unsigned long long i = 0; i < 5; i++) {
+        programs[i] = BM0__create_buffer(&error, 4096);
+    }
+    path = BM0__create_buffer(&error, strlen(file_path) + 1);
+    if (error == BM0__et__no_error) {
+        BM0__copy_bytes(file_path, path.p_length, path.p_data);
+    }
+    workloads[0] = BM0__benchmark__create_workload(&error, "operate_loop", programs[0], (unsigned long long)(BM0__benchmark__write_operate_loop(programs[0].p_data, 2000000) - programs[0].p_data), 0, 0, 4, 0);
+    workloads[1] = BM0__benchmark__create_workload(&error, "memory_copy_loop", programs[1], (unsigned long long)(BM0__benchmark__write_memory_copy_loop(programs[1].p_data, 1000000, 65536) - programs[1].p_data), 0, 0, 4, 2);
+    workloads[2] = BM0__benchmark__create_workload(&error, "allocation_churn", programs[2], (unsigned long long)(BM0__benchmark__write_allocation_churn_loop(programs[2].p_data, 50000, 4096) - programs[2].p_data), 0, 0, 4, 50000);
+    workloads[3] = BM0__benchmark__create_workload(&error, "file_io", programs[3], (unsigned long long)(BM0__benchmark__write_file_io_loop(programs[3].p_data, 50000, 4096) - programs[3].p_data), &path, 1, 4, 1);
+    workloads[4] = BM0__benchmark__create_workload(&error, "small_jobs", programs[4], (unsigned long long)(BM0__benchmark__write_small_job(programs[4].p_data) - programs[4].p_data), 0, 0, 20000, 0);
+    context = BM0__create_context(&error, BM0__define__max_allocation_count, BM0__boolean__true);
+    pool = BM0__create_thread_pool(&error, 0);
+    if (error != BM0__et__no_error) {
+        fprintf(stderr, "Buildtime Error Code: %llu\n", (unsigned long long)error);
+
+        return 1;
+    }
+
+    // measure
+    printf("workload\tengine\truns\tinstructions\tallocations\tseconds\tinstructions_per_second\tns_per_instruction\tallocations_per_second\tspeedup\tsame_output");
+    if (previous_results != 0) {
+        printf("\tprevious_ns_per_instruction\tchange");
+    }
+    printf("\n");
+    for (unsigned long long i = 0; i < 5; i++) {
+        BM0__benchmark__measure_workload(&error, &workloads[i], context, pool, previous_results);
+    }
+
+    // clean up
+    BM0__destroy_thread_pool(pool);
+    BM0__destroy_context(context);
+    for (unsigned long long i = 0; i < 5; i++) {
+        BM0__destroy_buffer(workloads[i].p_input);
+        BM0__destroy_buffer(programs[i]);
+    }
+    BM0__destroy_buffer(path);
+    unlink(file_path);
+    if (previous_results != 0) {
+        fclose(previous_results);
+    }
+
+    return 0;
+}
@@ -3,46 +3,48 @@
 #include "../../BM0.h"
 
 BM0__buffer BM0__example__create_program(BM0__et* allocation_error) {
-    BM0__buffer output = BM0__create_buffer(allocation_error, 10000);
+    BM0__assembler assembler = BM0__create_assembler(allocation_error);
+    BM0__buffer output;
     BM0__buffer msg = BM0__create_buffer_from_c_string_copy(allocation_error, "Hello World!\n");
-    void* index = output.p_data;
-    unsigned long long rodata_offset = 5000;
-    void* rodata_index = output.p_data + rodata_offset;
 
     // zero out registers
     for (unsigned long long i = BM0__rt__REGISTER_COUNT; i < BM0__define__register_count; i++) {
-        index = BM0__write_instruction__write_register(index, i, 0);
+        BM0__write_instruction__write_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__write_register), i, 0);
     }
 
     // write constant values
-    index = BM0__write_instruction__write_register(index, 200, sizeof(unsigned long long));
-    index = BM0__write_instruction__write_register(index, 201, rodata_offset);
-    index = BM0__write_instruction__write_register(index, 202, 1);
-    index = BM0__write_instruction__write_register(index, 203, msg.p_length);
+    BM0__write_instruction__write_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__write_register), 200, sizeof(unsigned long long));
+    BM0__assemble_label_offset(allocation_error, &assembler, 201, "msg");
+    BM0__write_instruction__write_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__write_register), 202, 1);
+    BM0__write_instruction__write_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__write_register), 203, msg.p_length);
 
     // get input buffers pointer
-    index = BM0__write_instruction__register_to_register(index, BM0__rt__input_buffers_pointer_register, 100);
+    BM0__write_instruction__register_to_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__register_to_register), BM0__rt__input_buffers_pointer_register, 100);
 
     // adjust input buffers pointer copy to be at input buffer address
-    index = BM0__write_instruction__operate(index, 255, 127, BM0__ot__integer__add, 100, 200, 100);
+    BM0__write_instruction__operate(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__operate), 255, 127, BM0__ot__integer__add, 100, 200, 100);
 
     // store input buffer 0 address
-    index = BM0__write_instruction__buffer_to_register(index, 100, sizeof(void*), 100);
+    BM0__write_instruction__buffer_to_register(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__buffer_to_register), 100, sizeof(void*), 100);
 
     // adjust input buffer 0 address to be at msg
-    index = BM0__write_instruction__operate(index, 255, 127, BM0__ot__integer__add, 100, 201, 100);
+    BM0__write_instruction__operate(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__operate), 255, 127, BM0__ot__integer__add, 100, 201, 100);
 
     // print msg
-    index = BM0__write_instruction__do_x86_64_linux_syscall_limited(index, BM0__st__write, 202, 100, 203, 0, 0, 0, 101);
+    BM0__write_instruction__do_x86_64_linux_syscall_limited(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__do_x86_64_linux_syscall_limited), BM0__st__write, 202, 100, 203, 0, 0, 0, 101);
 
     // exit gracefully
-    index = BM0__write_instruction__quit(index, 255, 255);
+    BM0__write_instruction__quit(BM0__reserve_assembly(allocation_error, &assembler, BM0__ilt__quit), 255, 255);
 
     // write msg to rodata
-    rodata_index = BM0__write_instruction__write_buffer_to_program(rodata_index, msg);
+    BM0__assemble_data(allocation_error, &assembler, "msg", msg);
+
+    // lay out program
+    output = BM0__finish_assembly(allocation_error, &assembler);
 
     // clean up data
     BM0__deallocate(msg.p_data, msg.p_length);
+    BM0__destroy_assembler(assembler);
 
     return output;
 }